@@ -0,0 +1,78 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+#include "types/Vec1.hpp"
+#include "types/Vec2.hpp"
+#include "types/Vec3.hpp"
+#include "types/Curve.hpp"
+
+using namespace R3::Math;
+
+// Best of several runs in nanoseconds per evaluated point
+template<typename F>
+double time_per_point(std::size_t points, F &&f)
+{
+    double best = 1e300;
+    for (int run = 0; run < 7; ++run) {
+        const auto start = std::chrono::steady_clock::now();
+        f();
+        const std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+        best = std::min(best, elapsed.count() / static_cast<double>(points));
+    }
+    return best;
+}
+
+// Bernstein form written with the Vec3 operators, the way callers evaluate a segment without Cubic
+Vec3<float> naive_bezier(const Vec3<float> (&p)[4], float t)
+{
+    const float s = 1.0f - t;
+    return p[0] * Vec3<float>(s * s * s) +
+           p[1] * Vec3<float>(3.0f * s * s * t) +
+           p[2] * Vec3<float>(3.0f * s * t * t) +
+           p[3] * Vec3<float>(t * t * t);
+}
+
+int main(int argc, char **argv)
+{
+    const std::size_t n = std::max<std::size_t>(argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 4000000, 1);
+    const Vec3<float> p[4] = { Vec3(0.0f, 0.0f, 0.0f), Vec3(1.0f, 2.0f, 0.5f), Vec3(3.0f, -1.0f, 1.0f), Vec3(4.0f, 0.0f, 2.0f) };
+    const auto curve = Cubic<float, 3>::bezier(p[0], p[1], p[2], p[3]);
+
+    std::vector<float> ts(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        ts[i] = n > 1 ? static_cast<float>(i) / static_cast<float>(n - 1) : 0.0f;
+    }
+    std::vector<Vec3<float>> naive(n), single(n), batch(n);
+
+    const double naive_ns = time_per_point(n, [&] {
+        for (std::size_t i = 0; i < n; ++i) {
+            naive[i] = naive_bezier(p, ts[i]);
+        }
+    });
+    const double single_ns = time_per_point(n, [&] {
+        for (std::size_t i = 0; i < n; ++i) {
+            single[i] = curve.position(ts[i]);
+        }
+    });
+    const double batch_ns = time_per_point(n, [&] {
+        curve.positions(ts, VecView<float, 3>(std::span(batch)));
+    });
+
+    // Largest component difference of the batch against both per-point paths
+    float error = 0.0f;
+    for (std::size_t i = 0; i < n; ++i) {
+        for (const auto &other : { naive[i], single[i] }) {
+            const Vec3<float> d = batch[i] - other;
+            error = std::max({ error, std::abs(d.x), std::abs(d.y), std::abs(d.z) });
+        }
+    }
+
+    std::cout << n << " points, max deviation " << error << '\n';
+    std::cout << "naive Vec3 operator chain  " << naive_ns << " ns/point\n";
+    std::cout << "Cubic::position loop       " << single_ns << " ns/point (" << naive_ns / single_ns << "x)\n";
+    std::cout << "Cubic::positions batch     " << batch_ns << " ns/point (" << naive_ns / batch_ns << "x)\n";
+    return error < 1e-3f ? 0 : 1;
+}
@@ -0,0 +1,119 @@
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+#include "types/Vec1.hpp"
+#include "types/Vec2.hpp"
+#include "types/Vec3.hpp"
+#include "operations/magnitude.hpp"
+#include "types/KdTree.hpp"
+#include "types/SpatialHashGrid.hpp"
+
+using namespace R3::Math;
+
+// Best of several runs in milliseconds
+template<typename F>
+double time_ms(int runs, F &&f)
+{
+    double best = 1e300;
+    for (int run = 0; run < runs; ++run) {
+        const auto start = std::chrono::steady_clock::now();
+        f();
+        const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+        best = std::min(best, elapsed.count());
+    }
+    return best;
+}
+
+// Reference answers from a full scan over every point, the way callers search without an index
+void brute_radius(const std::vector<Vec3<float>> &points, const Vec3<float> &c, float radius, std::vector<uint32_t> &out)
+{
+    out.clear();
+    for (uint32_t i = 0; i < points.size(); ++i) {
+        if (magnitude(points[i] - c) <= radius) {
+            out.push_back(i);
+        }
+    }
+}
+
+void brute_knn(const std::vector<Vec3<float>> &points, const Vec3<float> &c, std::size_t k, std::vector<uint32_t> &out)
+{
+    std::vector<std::pair<float, uint32_t>> found(points.size());
+    for (uint32_t i = 0; i < points.size(); ++i) {
+        found[i] = { magnitude(points[i] - c), i };
+    }
+    k = std::min(k, found.size());
+    std::partial_sort(found.begin(), found.begin() + k, found.end());
+    out.clear();
+    for (std::size_t i = 0; i < k; ++i) {
+        out.push_back(found[i].second);
+    }
+}
+
+// Same sets, knn results may only differ in the order of equidistant points
+bool same(std::vector<uint32_t> a, std::vector<uint32_t> b)
+{
+    std::sort(a.begin(), a.end());
+    std::sort(b.begin(), b.end());
+    return a == b;
+}
+
+int main(int argc, char **argv)
+{
+    const std::size_t n = std::max<std::size_t>(argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 1000000, 1);
+    const std::size_t q = 1000;
+    const std::size_t k = 8;
+
+    // Unit density, so a radius-2 query holds about 33 points and a cell of 2 about 8
+    const float extent = std::cbrt(static_cast<float>(n));
+    std::mt19937 rng(26);
+    std::uniform_real_distribution<float> dist(0.0f, extent);
+    std::vector<Vec3<float>> points(n), queries(q);
+    for (auto &p : points) {
+        p = Vec3(dist(rng), dist(rng), dist(rng));
+    }
+    for (auto &p : queries) {
+        p = Vec3(dist(rng), dist(rng), dist(rng));
+    }
+    const float radius = 2.0f;
+
+    SpatialHashGrid<float> grid;
+    KdTree<float> tree;
+    const double grid_build = time_ms(3, [&] { grid.build(points, radius); });
+    const double tree_build = time_ms(3, [&] { tree.build(points); });
+
+    std::vector<std::vector<uint32_t>> grid_radius, tree_radius, grid_knn, tree_knn;
+    std::vector<std::vector<uint32_t>> brute_radius_out(q), brute_knn_out(q);
+    const double grid_radius_ms = time_ms(5, [&] { grid.radius_query(queries, radius, grid_radius); });
+    const double tree_radius_ms = time_ms(5, [&] { tree.radius_query(queries, radius, tree_radius); });
+    const double grid_knn_ms = time_ms(5, [&] { grid.knn_query(queries, k, grid_knn); });
+    const double tree_knn_ms = time_ms(5, [&] { tree.knn_query(queries, k, tree_knn); });
+    const double brute_radius_ms = time_ms(1, [&] {
+        for (std::size_t i = 0; i < q; ++i) {
+            brute_radius(points, queries[i], radius, brute_radius_out[i]);
+        }
+    });
+    const double brute_knn_ms = time_ms(1, [&] {
+        for (std::size_t i = 0; i < q; ++i) {
+            brute_knn(points, queries[i], k, brute_knn_out[i]);
+        }
+    });
+
+    std::size_t mismatches = 0;
+    for (std::size_t i = 0; i < q; ++i) {
+        mismatches += !same(grid_radius[i], brute_radius_out[i]) + !same(tree_radius[i], brute_radius_out[i]);
+        mismatches += !same(grid_knn[i], brute_knn_out[i]) + !same(tree_knn[i], brute_knn_out[i]);
+    }
+
+    std::cout << n << " points, " << q << " queries, " << mismatches << " mismatches\n";
+    std::cout << "build     grid " << grid_build << " ms, k-d tree " << tree_build << " ms\n";
+    std::cout << "radius    grid " << grid_radius_ms << " ms, k-d tree " << tree_radius_ms << " ms, brute force "
+              << brute_radius_ms << " ms (" << brute_radius_ms / grid_radius_ms << "x, " << brute_radius_ms / tree_radius_ms << "x)\n";
+    std::cout << "knn       grid " << grid_knn_ms << " ms, k-d tree " << tree_knn_ms << " ms, brute force "
+              << brute_knn_ms << " ms (" << brute_knn_ms / grid_knn_ms << "x, " << brute_knn_ms / tree_knn_ms << "x)\n";
+    return mismatches == 0 ? 0 : 1;
+}
@@ -0,0 +1,86 @@
+#pragma once
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <span>
+#include "types/Vec1.hpp"
+#include "types/Vec2.hpp"
+#include "types/Vec3.hpp"
+#include "types/Mat.hpp"
+#include "parallel.hpp"
+
+namespace R3::Math {
+
+template<std::floating_point T>
+struct Moments3
+{
+    Vec3<T> mean;
+    Mat3<T> covariance;
+};
+
+// Two passes, the second accumulates about the mean so large offsets do not cancel. Both are
+// reduced in a fixed block order, so the result is the same on every run
+template<std::floating_point T>
+Moments3<T> moments(std::span<const Vec3<T>> points)
+{
+    const std::size_t n = points.size();
+    if (n == 0) {
+        return Moments3<T> { Vec3<T>(T(0)), Mat3<T>(T(0)) };
+    }
+
+    const auto add = [](auto a, const auto &b) {
+        for (std::size_t j = 0; j < a.size(); ++j) {
+            a[j] += b[j];
+        }
+        return a;
+    };
+
+    const auto sum = parallel_reduce(n, std::array<T, 3> {}, [&](std::size_t begin, std::size_t end) {
+        std::array<T, 3> s = {};
+        for (std::size_t i = begin; i < end; ++i) {
+            s[0] += points[i].x;
+            s[1] += points[i].y;
+            s[2] += points[i].z;
+        }
+        return s;
+    }, add);
+    const T inv_n = T(1) / static_cast<T>(n);
+    const Vec3<T> mean(sum[0] * inv_n, sum[1] * inv_n, sum[2] * inv_n);
+
+    // xx, xy, xz, yy, yz, zz
+    auto c = parallel_reduce(n, std::array<T, 6> {}, [&](std::size_t begin, std::size_t end) {
+        std::array<T, 6> s = {};
+        for (std::size_t i = begin; i < end; ++i) {
+            const T dx = points[i].x - mean.x;
+            const T dy = points[i].y - mean.y;
+            const T dz = points[i].z - mean.z;
+            s[0] += dx * dx;
+            s[1] += dx * dy;
+            s[2] += dx * dz;
+            s[3] += dy * dy;
+            s[4] += dy * dz;
+            s[5] += dz * dz;
+        }
+        return s;
+    }, add);
+    for (auto &cj : c) {
+        cj *= inv_n;
+    }
+
+    return Moments3<T> {
+            mean,
+            Mat3<T> {
+                    Vec3<T>(c[0], c[1], c[2]),
+                    Vec3<T>(c[1], c[3], c[4]),
+                    Vec3<T>(c[2], c[4], c[5]),
+            },
+    };
+}
+
+template<std::floating_point T>
+Mat3<T> covariance(std::span<const Vec3<T>> points)
+{
+    return moments(points).covariance;
+}
+
+} // R3::Math
@@ -0,0 +1,18 @@
+#pragma once
+#include "types/Vec1.hpp"
+#include "types/Vec2.hpp"
+#include "types/Vec3.hpp"
+
+namespace R3::Math {
+
+template<Scalar T, Scalar U>
+constexpr Vec3<T> cross(const Vec3<T> &v1, const Vec3<U> &v2)
+{
+    return Vec3<T> {
+            static_cast<T>(v1.y * v2.z - v1.z * v2.y),
+            static_cast<T>(v1.z * v2.x - v1.x * v2.z),
+            static_cast<T>(v1.x * v2.y - v1.y * v2.x),
+    };
+}
+
+} // R3::Math
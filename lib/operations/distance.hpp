@@ -0,0 +1,24 @@
+#pragma once
+#include "types/Vec1.hpp"
+#include "types/Vec2.hpp"
+#include "types/Vec3.hpp"
+#include "types/Vec4.hpp"
+#include "dot.hpp"
+#include "magnitude.hpp"
+
+namespace R3::Math {
+
+template<typename T>
+constexpr auto distance_squared(const T &v1, const T &v2) requires (requires(const T &_v) { dot(_v, _v); })
+{
+    const T d = v1 - v2;
+    return dot(d, d);
+}
+
+template<typename T>
+constexpr auto distance(const T &v1, const T &v2) requires (requires(const T &_v) { dot(_v, _v); })
+{
+    return magnitude(T(v1 - v2));
+}
+
+} // R3::Math
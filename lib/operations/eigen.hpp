@@ -0,0 +1,261 @@
+#pragma once
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <limits>
+#include <span>
+#include "types/Vec1.hpp"
+#include "types/Vec2.hpp"
+#include "types/Vec3.hpp"
+#include "types/Mat.hpp"
+#include "parallel.hpp"
+
+namespace R3::Math {
+
+// Eigenvalues in descending order, vectors[i] is the unit eigenvector of values component i
+template<std::floating_point T>
+struct SymmetricEigen3
+{
+    Vec3<T> values;
+    Mat3<T> vectors;
+};
+
+// m = u * diag(sigma) * transpose(v), sigma.z carries the sign when m is a reflection
+template<std::floating_point T>
+struct Svd3
+{
+    Mat3<T> u;
+    Vec3<T> sigma;
+    Mat3<T> v;
+};
+
+namespace detail {
+
+// One 512-bit register worth of matrices per group, every lane runs the same branch-free sequence
+template<std::floating_point T>
+constexpr std::size_t eigen_lanes = 64 / sizeof(T);
+
+template<std::floating_point T>
+constexpr std::size_t jacobi_sweeps = sizeof(T) == sizeof(float) ? 5 : 8;
+
+template<std::floating_point T, std::size_t L>
+using Lanes3x3 = T[3][3][L];
+
+template<std::floating_point T, std::size_t L>
+void jacobi_rotate(Lanes3x3<T, L> &a, Lanes3x3<T, L> &v, std::size_t p, std::size_t q)
+{
+    const std::size_t r = 3 - p - q;
+    for (std::size_t l = 0; l < L; ++l) {
+        const T apq = a[p][q][l];
+        const T d = a[q][q][l] - a[p][p][l];
+        const T root = std::sqrt(d * d + 4 * apq * apq);
+        const T denom = d + std::copysign(root, d);
+        const T t = 2 * apq / (denom == 0 ? T(1) : denom);
+        const T c = 1 / std::sqrt(1 + t * t);
+        const T s = t * c;
+        const T arp = a[r][p][l];
+        const T arq = a[r][q][l];
+        a[p][p][l] -= t * apq;
+        a[q][q][l] += t * apq;
+        a[p][q][l] = a[q][p][l] = 0;
+        a[r][p][l] = a[p][r][l] = c * arp - s * arq;
+        a[r][q][l] = a[q][r][l] = s * arp + c * arq;
+        for (std::size_t k = 0; k < 3; ++k) {
+            const T vkp = v[k][p][l];
+            const T vkq = v[k][q][l];
+            v[k][p][l] = c * vkp - s * vkq;
+            v[k][q][l] = s * vkp + c * vkq;
+        }
+    }
+}
+
+template<std::floating_point T, std::size_t L>
+void sort_descending(Lanes3x3<T, L> &a, Lanes3x3<T, L> &v, std::size_t i, std::size_t j)
+{
+    for (std::size_t l = 0; l < L; ++l) {
+        const bool swap = a[i][i][l] < a[j][j][l];
+        const T ai = a[i][i][l];
+        const T aj = a[j][j][l];
+        a[i][i][l] = swap ? aj : ai;
+        a[j][j][l] = swap ? ai : aj;
+        for (std::size_t k = 0; k < 3; ++k) {
+            const T vi = v[k][i][l];
+            const T vj = v[k][j][l];
+            v[k][i][l] = swap ? vj : vi;
+            v[k][j][l] = swap ? vi : vj;
+        }
+    }
+}
+
+template<std::floating_point T, std::size_t L>
+void jacobi(Lanes3x3<T, L> &a, Lanes3x3<T, L> &v)
+{
+    for (std::size_t r = 0; r < 3; ++r) {
+        for (std::size_t c = 0; c < 3; ++c) {
+            for (std::size_t l = 0; l < L; ++l) {
+                v[r][c][l] = r == c ? T(1) : T(0);
+            }
+        }
+    }
+    for (std::size_t sweep = 0; sweep < jacobi_sweeps<T>; ++sweep) {
+        jacobi_rotate<T, L>(a, v, 0, 1);
+        jacobi_rotate<T, L>(a, v, 0, 2);
+        jacobi_rotate<T, L>(a, v, 1, 2);
+    }
+    sort_descending<T, L>(a, v, 0, 1);
+    sort_descending<T, L>(a, v, 1, 2);
+    sort_descending<T, L>(a, v, 0, 1);
+}
+
+template<std::floating_point T, std::size_t L>
+void load_lanes(std::span<const Mat3<T>> m, std::size_t offset, Lanes3x3<T, L> &a)
+{
+    for (std::size_t l = 0; l < L; ++l) {
+        const bool live = offset + l < m.size();
+        for (std::size_t r = 0; r < 3; ++r) {
+            for (std::size_t c = 0; c < 3; ++c) {
+                a[r][c][l] = live ? m[offset + l](r, c) : T(0);
+            }
+        }
+    }
+}
+
+template<std::floating_point T, std::size_t L>
+Mat3<T> store_lane(const Lanes3x3<T, L> &a, std::size_t l)
+{
+    return Mat3<T> {
+            Vec3<T>(a[0][0][l], a[1][0][l], a[2][0][l]),
+            Vec3<T>(a[0][1][l], a[1][1][l], a[2][1][l]),
+            Vec3<T>(a[0][2][l], a[1][2][l], a[2][2][l]),
+    };
+}
+
+template<std::floating_point T, std::size_t L>
+void eig3_lanes(std::span<const Mat3<T>> symmetric, std::size_t offset, std::span<SymmetricEigen3<T>> out)
+{
+    Lanes3x3<T, L> a, v;
+    load_lanes<T, L>(symmetric, offset, a);
+    jacobi<T, L>(a, v);
+    for (std::size_t l = 0; l < L && offset + l < symmetric.size(); ++l) {
+        out[offset + l] = SymmetricEigen3<T> {
+                Vec3<T>(a[0][0][l], a[1][1][l], a[2][2][l]),
+                store_lane<T, L>(v, l),
+        };
+    }
+}
+
+template<std::floating_point T, std::size_t L>
+void svd3_lanes(std::span<const Mat3<T>> m, std::size_t offset, std::span<Svd3<T>> out)
+{
+    constexpr T eps = std::numeric_limits<T>::epsilon();
+    constexpr T tiny = std::numeric_limits<T>::min();
+
+    Lanes3x3<T, L> a, ata, v, b;
+    load_lanes<T, L>(m, offset, a);
+
+    // V from the eigenvectors of transpose(m) * m, then B = m * V has orthogonal columns
+    for (std::size_t r = 0; r < 3; ++r) {
+        for (std::size_t c = 0; c < 3; ++c) {
+            for (std::size_t l = 0; l < L; ++l) {
+                ata[r][c][l] = a[0][r][l] * a[0][c][l] + a[1][r][l] * a[1][c][l] + a[2][r][l] * a[2][c][l];
+            }
+        }
+    }
+    jacobi<T, L>(ata, v);
+    for (std::size_t r = 0; r < 3; ++r) {
+        for (std::size_t c = 0; c < 3; ++c) {
+            for (std::size_t l = 0; l < L; ++l) {
+                b[r][c][l] = a[r][0][l] * v[0][c][l] + a[r][1][l] * v[1][c][l] + a[r][2][l] * v[2][c][l];
+            }
+        }
+    }
+
+    // Gram-Schmidt on B with fallbacks for rank-deficient input, the last column closes the frame
+    Lanes3x3<T, L> u;
+    T sigma[3][L];
+    for (std::size_t l = 0; l < L; ++l) {
+        const T b0x = b[0][0][l], b0y = b[1][0][l], b0z = b[2][0][l];
+        const T len0 = std::sqrt(b0x * b0x + b0y * b0y + b0z * b0z);
+        const bool ok0 = len0 > tiny;
+        const T inv0 = ok0 ? 1 / len0 : T(0);
+        const T u0x = ok0 ? b0x * inv0 : T(1), u0y = b0y * inv0, u0z = b0z * inv0;
+
+        const T b1x = b[0][1][l], b1y = b[1][1][l], b1z = b[2][1][l];
+        const T p = u0x * b1x + u0y * b1y + u0z * b1z;
+        const T w1x = b1x - p * u0x, w1y = b1y - p * u0y, w1z = b1z - p * u0z;
+        const T len1 = std::sqrt(w1x * w1x + w1y * w1y + w1z * w1z);
+        const bool ok1 = len1 > eps * len0 + tiny;
+        const bool use_x = std::abs(u0x) < T(0.5);
+        const T fx = use_x ? T(0) : -u0z, fy = use_x ? u0z : T(0), fz = use_x ? -u0y : u0x;
+        const T flen = std::sqrt(fx * fx + fy * fy + fz * fz);
+        const T inv1 = ok1 ? 1 / len1 : 1 / flen;
+        const T u1x = (ok1 ? w1x : fx) * inv1, u1y = (ok1 ? w1y : fy) * inv1, u1z = (ok1 ? w1z : fz) * inv1;
+
+        const T u2x = u0y * u1z - u0z * u1y, u2y = u0z * u1x - u0x * u1z, u2z = u0x * u1y - u0y * u1x;
+
+        u[0][0][l] = u0x;
+        u[1][0][l] = u0y;
+        u[2][0][l] = u0z;
+        u[0][1][l] = u1x;
+        u[1][1][l] = u1y;
+        u[2][1][l] = u1z;
+        u[0][2][l] = u2x;
+        u[1][2][l] = u2y;
+        u[2][2][l] = u2z;
+        sigma[0][l] = len0;
+        sigma[1][l] = ok1 ? len1 : T(0);
+        sigma[2][l] = u2x * b[0][2][l] + u2y * b[1][2][l] + u2z * b[2][2][l];
+    }
+
+    for (std::size_t l = 0; l < L && offset + l < m.size(); ++l) {
+        out[offset + l] = Svd3<T> {
+                store_lane<T, L>(u, l),
+                Vec3<T>(sigma[0][l], sigma[1][l], sigma[2][l]),
+                store_lane<T, L>(v, l),
+        };
+    }
+}
+
+} // detail
+
+// Batch Decompositions
+template<std::floating_point T>
+void eig3(std::span<const Mat3<T>> symmetric, std::span<SymmetricEigen3<T>> out)
+{
+    constexpr std::size_t L = detail::eigen_lanes<T>;
+    parallel_for((symmetric.size() + L - 1) / L, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t g = begin; g < end; ++g) {
+            detail::eig3_lanes<T, L>(symmetric, g * L, out);
+        }
+    }, 16);
+}
+
+template<std::floating_point T>
+void svd3(std::span<const Mat3<T>> m, std::span<Svd3<T>> out)
+{
+    constexpr std::size_t L = detail::eigen_lanes<T>;
+    parallel_for((m.size() + L - 1) / L, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t g = begin; g < end; ++g) {
+            detail::svd3_lanes<T, L>(m, g * L, out);
+        }
+    }, 16);
+}
+
+// Single Decompositions
+template<std::floating_point T>
+SymmetricEigen3<T> eig3(const Mat3<T> &symmetric)
+{
+    SymmetricEigen3<T> out;
+    detail::eig3_lanes<T, 1>(std::span(&symmetric, 1), 0, std::span(&out, 1));
+    return out;
+}
+
+template<std::floating_point T>
+Svd3<T> svd3(const Mat3<T> &m)
+{
+    Svd3<T> out;
+    detail::svd3_lanes<T, 1>(std::span(&m, 1), 0, std::span(&out, 1));
+    return out;
+}
+
+} // R3::Math
@@ -0,0 +1,416 @@
+#pragma once
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <limits>
+#include <span>
+#include <utility>
+#include <vector>
+#include "types/Vec1.hpp"
+#include "types/Vec2.hpp"
+#include "types/Vec3.hpp"
+#include "types/Shapes.hpp"
+#include "dot.hpp"
+#include "cross.hpp"
+#include "parallel.hpp"
+
+namespace R3::Math {
+
+// Closest points on each shape, distance is zero and the points meaningless when intersecting
+template<std::floating_point T>
+struct GjkResult
+{
+    bool intersecting;
+    T distance;
+    Vec3<T> point_a, point_b;
+};
+
+// Moving b by normal * depth separates the shapes, points are the deepest contacts on each. Without
+// converged the iteration budget ran out first and depth is only a lower bound, typical for curved shapes
+template<std::floating_point T>
+struct Penetration
+{
+    bool intersecting;
+    T depth;
+    Vec3<T> normal;
+    Vec3<T> point_a, point_b;
+    bool converged;
+};
+
+template<std::floating_point T>
+struct Simplex
+{
+    // w = a - b, a and b the supports on each shape that produced it
+    Vec3<T> w[4], a[4], b[4];
+    T lambda[4];
+    std::size_t size = 0;
+
+    void keep(std::initializer_list<std::pair<std::size_t, T>> vertices) {
+        Vec3<T> nw[4], na[4], nb[4];
+        std::size_t n = 0;
+        for (const auto &[i, l] : vertices) {
+            nw[n] = this->w[i];
+            na[n] = this->a[i];
+            nb[n] = this->b[i];
+            this->lambda[n] = l;
+            ++n;
+        }
+        for (std::size_t i = 0; i < n; ++i) {
+            this->w[i] = nw[i];
+            this->a[i] = na[i];
+            this->b[i] = nb[i];
+        }
+        this->size = n;
+    }
+};
+
+namespace detail {
+
+template<std::floating_point T>
+constexpr Vec3<T> scale(const Vec3<T> &v, T s)
+{
+    return v * Vec3<T>(s);
+}
+
+// Closest point of the triangle (A, B, C) to the origin as barycentric weights, Ericson 5.1.5
+template<std::floating_point T>
+std::array<T, 3> closest_on_triangle(const Vec3<T> &A, const Vec3<T> &B, const Vec3<T> &C)
+{
+    const Vec3<T> ab = B - A, ac = C - A;
+    const T d1 = -dot(ab, A), d2 = -dot(ac, A);
+    if (d1 <= 0 && d2 <= 0) {
+        return { 1, 0, 0 };
+    }
+    const T d3 = -dot(ab, B), d4 = -dot(ac, B);
+    if (d3 >= 0 && d4 <= d3) {
+        return { 0, 1, 0 };
+    }
+    const T vc = d1 * d4 - d3 * d2;
+    if (vc <= 0 && d1 >= 0 && d3 <= 0) {
+        const T v = d1 / (d1 - d3);
+        return { 1 - v, v, 0 };
+    }
+    const T d5 = -dot(ab, C), d6 = -dot(ac, C);
+    if (d6 >= 0 && d5 <= d6) {
+        return { 0, 0, 1 };
+    }
+    const T vb = d5 * d2 - d1 * d6;
+    if (vb <= 0 && d2 >= 0 && d6 <= 0) {
+        const T w = d2 / (d2 - d6);
+        return { 1 - w, 0, w };
+    }
+    const T va = d3 * d6 - d5 * d4;
+    if (va <= 0 && d4 - d3 >= 0 && d5 - d6 >= 0) {
+        const T w = (d4 - d3) / ((d4 - d3) + (d5 - d6));
+        return { 0, 1 - w, w };
+    }
+    const T denom = 1 / (va + vb + vc);
+    const T v = vb * denom, w = vc * denom;
+    return { 1 - v - w, v, w };
+}
+
+template<std::floating_point T>
+void reduce_triangle(Simplex<T> &s, std::size_t i, std::size_t j, std::size_t k)
+{
+    const auto l = closest_on_triangle(s.w[i], s.w[j], s.w[k]);
+    if (l[1] == 0 && l[2] == 0) {
+        s.keep({ { i, T(1) } });
+    } else if (l[0] == 0 && l[2] == 0) {
+        s.keep({ { j, T(1) } });
+    } else if (l[0] == 0 && l[1] == 0) {
+        s.keep({ { k, T(1) } });
+    } else if (l[2] == 0) {
+        s.keep({ { i, l[0] }, { j, l[1] } });
+    } else if (l[1] == 0) {
+        s.keep({ { i, l[0] }, { k, l[2] } });
+    } else if (l[0] == 0) {
+        s.keep({ { j, l[1] }, { k, l[2] } });
+    } else {
+        s.keep({ { i, l[0] }, { j, l[1] }, { k, l[2] } });
+    }
+}
+
+template<std::floating_point T>
+Vec3<T> combine(const Simplex<T> &s, const Vec3<T> (&points)[4])
+{
+    Vec3<T> p(T(0));
+    for (std::size_t i = 0; i < s.size; ++i) {
+        p += scale(points[i], s.lambda[i]);
+    }
+    return p;
+}
+
+// Shrinks the simplex to the sub-simplex nearest the origin, returns false once the origin is enclosed
+template<std::floating_point T>
+bool reduce(Simplex<T> &s)
+{
+    if (s.size == 1) {
+        s.lambda[0] = 1;
+    } else if (s.size == 2) {
+        const Vec3<T> ab = s.w[1] - s.w[0];
+        const T len2 = dot(ab, ab);
+        const T t = len2 > 0 ? std::clamp(-dot(s.w[0], ab) / len2, T(0), T(1)) : T(0);
+        if (t <= 0) {
+            s.keep({ { 0, T(1) } });
+        } else if (t >= 1) {
+            s.keep({ { 1, T(1) } });
+        } else {
+            s.keep({ { 0, 1 - t }, { 1, t } });
+        }
+    } else if (s.size == 3) {
+        reduce_triangle(s, 0, 1, 2);
+    } else {
+        constexpr std::size_t faces[4][4] = { { 0, 1, 2, 3 }, { 0, 3, 1, 2 }, { 0, 2, 3, 1 }, { 1, 3, 2, 0 } };
+        const Vec3<T> e1 = s.w[1] - s.w[0], e2 = s.w[2] - s.w[0], e3 = s.w[3] - s.w[0];
+        const T volume = dot(cross(e1, e2), e3);
+        // A flat tetrahedron encloses nothing, its side tests are noise so every face is searched
+        const bool flat = volume * volume <= std::numeric_limits<T>::epsilon() * dot(e1, e1) * dot(e2, e2) * dot(e3, e3);
+
+        T best = std::numeric_limits<T>::max();
+        Simplex<T> nearest = s;
+        bool outside_any = false;
+        for (const auto &f : faces) {
+            const Vec3<T> n = cross(s.w[f[1]] - s.w[f[0]], s.w[f[2]] - s.w[f[0]]);
+            if (flat || dot(n, s.w[f[0]]) * dot(n, s.w[f[3]] - s.w[f[0]]) >= 0) {
+                Simplex<T> candidate = s;
+                reduce_triangle(candidate, f[0], f[1], f[2]);
+                const Vec3<T> v = combine(candidate, candidate.w);
+                if (dot(v, v) < best) {
+                    best = dot(v, v);
+                    nearest = candidate;
+                }
+                outside_any = true;
+            }
+        }
+        if (!outside_any) {
+            return false;
+        }
+        s = nearest;
+    }
+    return true;
+}
+
+} // detail
+
+// GJK distance between two convex shapes with a support() mapping
+template<typename A, typename B, std::floating_point T = typename A::scalar_type>
+GjkResult<T> gjk_distance(const A &shape_a, const B &shape_b, Simplex<T> *simplex = nullptr, std::size_t max_iterations = 64)
+{
+    constexpr T eps = std::numeric_limits<T>::epsilon() * 128;
+    Simplex<T> s;
+    const Vec3<T> d0(T(1), T(0), T(0));
+    s.a[0] = support(shape_a, d0);
+    s.b[0] = support(shape_b, -d0);
+    s.w[0] = s.a[0] - s.b[0];
+    s.lambda[0] = 1;
+    s.size = 1;
+
+    GjkResult<T> result { false, T(0), s.a[0], s.b[0] };
+    for (std::size_t iteration = 0; iteration < max_iterations; ++iteration) {
+        if (!detail::reduce(s)) {
+            result.intersecting = true;
+            break;
+        }
+        const Vec3<T> v = detail::combine(s, s.w);
+        const T v2 = dot(v, v);
+        result.point_a = detail::combine(s, s.a);
+        result.point_b = detail::combine(s, s.b);
+        result.distance = std::sqrt(v2);
+        if (v2 <= eps * eps) {
+            result.intersecting = true;
+            break;
+        }
+
+        const Vec3<T> a = support(shape_a, -v);
+        const Vec3<T> b = support(shape_b, v);
+        const Vec3<T> w = a - b;
+        bool repeated = false;
+        for (std::size_t i = 0; i < s.size; ++i) {
+            repeated |= s.w[i] == w;
+        }
+        if (repeated || v2 - dot(v, w) <= eps * v2) {
+            break;
+        }
+        s.w[s.size] = w;
+        s.a[s.size] = a;
+        s.b[s.size] = b;
+        ++s.size;
+    }
+
+    if (result.intersecting) {
+        result.distance = 0;
+    }
+    if (simplex) {
+        *simplex = s;
+    }
+    return result;
+}
+
+// Expanding polytope from an enclosing GJK simplex to the penetration depth and normal
+template<typename A, typename B, std::floating_point T = typename A::scalar_type>
+Penetration<T> epa(const A &shape_a, const B &shape_b, std::size_t max_iterations = 64)
+{
+    Simplex<T> s;
+    const auto gjk = gjk_distance(shape_a, shape_b, &s);
+    if (!gjk.intersecting) {
+        return Penetration<T> { false, T(0), Vec3<T>(T(0)), gjk.point_a, gjk.point_b, true };
+    }
+
+    constexpr T eps = std::numeric_limits<T>::epsilon() * 128;
+    std::vector<Vec3<T>> w(s.w, s.w + s.size), pa(s.a, s.a + s.size), pb(s.b, s.b + s.size);
+    const auto add = [&](const Vec3<T> &d) {
+        const Vec3<T> a = support(shape_a, d);
+        const Vec3<T> b = support(shape_b, -d);
+        w.push_back(a - b);
+        pa.push_back(a);
+        pb.push_back(b);
+    };
+    const auto drop = [&] {
+        w.pop_back();
+        pa.pop_back();
+        pb.pop_back();
+    };
+
+    // Blow a touching or degenerate simplex up into a tetrahedron
+    const Vec3<T> axes[3] = { Vec3<T>(1, 0, 0), Vec3<T>(0, 1, 0), Vec3<T>(0, 0, 1) };
+    for (std::size_t i = 0; w.size() == 1 && i < 6; ++i) {
+        add(i < 3 ? axes[i] : -axes[i - 3]);
+        if (dot(w[1] - w[0], w[1] - w[0]) <= eps) {
+            drop();
+        }
+    }
+    if (w.size() == 2) {
+        const Vec3<T> line = w[1] - w[0];
+        for (const auto &axis : axes) {
+            const Vec3<T> d = cross(line, axis);
+            if (dot(d, d) <= eps) {
+                continue;
+            }
+            add(d);
+            if (dot(cross(w[2] - w[0], line), cross(w[2] - w[0], line)) > eps) {
+                break;
+            }
+            drop();
+            add(-d);
+            if (dot(cross(w[2] - w[0], line), cross(w[2] - w[0], line)) > eps) {
+                break;
+            }
+            drop();
+        }
+    }
+    if (w.size() == 3) {
+        const Vec3<T> n = cross(w[1] - w[0], w[2] - w[0]);
+        add(n);
+        if (std::abs(dot(w[3] - w[0], n)) <= eps) {
+            drop();
+            add(-n);
+        }
+    }
+    if (w.size() < 4) {
+        return Penetration<T> { true, T(0), Vec3<T>(T(0)), gjk.point_a, gjk.point_b, true };
+    }
+
+    // Faces are oriented away from the starting centroid, which stays inside the growing polytope
+    struct Face { std::size_t i, j, k; Vec3<T> n; T d; };
+    std::vector<Face> faces;
+    const Vec3<T> centroid = detail::scale(w[0] + w[1] + w[2] + w[3], T(0.25));
+    const auto make_face = [&](std::size_t i, std::size_t j, std::size_t k) {
+        const Vec3<T> e1 = w[j] - w[i], e2 = w[k] - w[i];
+        Vec3<T> n = cross(e1, e2);
+        const T len = std::sqrt(dot(n, n));
+        // A support point collinear with a horizon edge spans no area, its zero normal must never be nearest
+        if (len <= eps * std::sqrt(dot(e1, e1) * dot(e2, e2))) {
+            return;
+        }
+        n = detail::scale(n, 1 / len);
+        if (dot(n, w[i] - centroid) < 0) {
+            n = -n;
+            std::swap(j, k);
+        }
+        faces.push_back({ i, j, k, n, std::max(dot(n, w[i]), T(0)) });
+    };
+    make_face(0, 1, 2);
+    make_face(0, 3, 1);
+    make_face(0, 2, 3);
+    make_face(1, 3, 2);
+
+    const auto nearest = [&] {
+        std::size_t closest = 0;
+        for (std::size_t f = 1; f < faces.size(); ++f) {
+            closest = faces[f].d < faces[closest].d ? f : closest;
+        }
+        return closest;
+    };
+
+    bool converged = false;
+    for (std::size_t iteration = 0; iteration < max_iterations && !faces.empty(); ++iteration) {
+        const Face face = faces[nearest()];
+        add(face.n);
+        const std::size_t p = w.size() - 1;
+        if (dot(w[p], face.n) - face.d <= eps * std::max(T(1), face.d)) {
+            converged = true;
+            break;
+        }
+
+        // Remove every face the new point sees, keeping the edges of the hole
+        std::vector<std::pair<std::size_t, std::size_t>> horizon;
+        const auto edge = [&](std::size_t a, std::size_t b) {
+            const auto reverse = std::find(horizon.begin(), horizon.end(), std::make_pair(b, a));
+            if (reverse != horizon.end()) {
+                horizon.erase(reverse);
+            } else {
+                horizon.emplace_back(a, b);
+            }
+        };
+        for (std::size_t f = 0; f < faces.size();) {
+            if (dot(faces[f].n, w[p] - w[faces[f].i]) > eps * std::max(T(1), faces[f].d)) {
+                edge(faces[f].i, faces[f].j);
+                edge(faces[f].j, faces[f].k);
+                edge(faces[f].k, faces[f].i);
+                faces[f] = faces.back();
+                faces.pop_back();
+            } else {
+                ++f;
+            }
+        }
+        for (const auto &[a, b] : horizon) {
+            make_face(a, b, p);
+        }
+    }
+
+    if (faces.empty()) {
+        return Penetration<T> { true, T(0), Vec3<T>(T(0)), gjk.point_a, gjk.point_b, false };
+    }
+    // The last expansion may have replaced the face the loop picked, search the final polytope
+    const Face &face = faces[nearest()];
+    const Vec3<T> origin_on_face = detail::scale(face.n, face.d);
+    const auto l = detail::closest_on_triangle(w[face.i] - origin_on_face, w[face.j] - origin_on_face, w[face.k] - origin_on_face);
+    const Vec3<T> point_a = detail::scale(pa[face.i], l[0]) + detail::scale(pa[face.j], l[1]) + detail::scale(pa[face.k], l[2]);
+    const Vec3<T> point_b = detail::scale(pb[face.i], l[0]) + detail::scale(pb[face.j], l[1]) + detail::scale(pb[face.k], l[2]);
+    return Penetration<T> { true, face.d, face.n, point_a, point_b, converged };
+}
+
+// Batch Queries, pair i is (a[i], b[i])
+template<typename A, typename B, std::floating_point T>
+void gjk_distance(std::span<const A> a, std::span<const B> b, std::span<GjkResult<T>> out)
+{
+    parallel_for(out.size(), [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) {
+            out[i] = gjk_distance(a[i], b[i]);
+        }
+    }, 256);
+}
+
+template<typename A, typename B, std::floating_point T>
+void epa(std::span<const A> a, std::span<const B> b, std::span<Penetration<T>> out)
+{
+    parallel_for(out.size(), [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) {
+            out[i] = epa(a[i], b[i]);
+        }
+    }, 64);
+}
+
+} // R3::Math
@@ -13,9 +13,8 @@ constexpr auto magnitude(const T &v) requires (requires(const T &_v) { dot(_v, _
 {
     if constexpr (std::is_same_v<T, Vec1<decltype(v.x)>>) {
         return v.x;
-    } else if constexpr (std::is_same_v<decltype(v.x), float>) {
-        return sqrtf(dot(v, v));
-    } else if constexpr (std::is_same_v<decltype(v.x), double>) {
+    } else {
+        using std::sqrt;
         return sqrt(dot(v, v));
     }
 }
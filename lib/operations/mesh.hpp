@@ -0,0 +1,187 @@
+#pragma once
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <span>
+#include <vector>
+#include "types/Vec1.hpp"
+#include "types/Vec2.hpp"
+#include "types/Vec3.hpp"
+#include "types/Vec4.hpp"
+#include "dot.hpp"
+#include "cross.hpp"
+#include "magnitude.hpp"
+#include "parallel.hpp"
+#include "radix_sort.hpp"
+
+namespace R3::Math {
+
+// Triangle lists, triangle t is (indices[3t], indices[3t + 1], indices[3t + 2]) with counter-clockwise front faces
+
+template<std::floating_point T>
+struct Bounds3
+{
+    Vec3<T> lo, hi;
+};
+
+namespace detail {
+
+// Twice the area along the face normal
+template<std::floating_point T>
+constexpr Vec3<T> face_cross(std::span<const Vec3<T>> positions, std::span<const uint32_t> indices, std::size_t t)
+{
+    const Vec3<T> &p0 = positions[indices[3 * t]];
+    return cross(positions[indices[3 * t + 1]] - p0, positions[indices[3 * t + 2]] - p0);
+}
+
+template<std::floating_point T>
+constexpr Vec3<T> unit_or_zero(const Vec3<T> &v)
+{
+    const T len = magnitude(v);
+    return len > 0 ? v / Vec3<T>(len) : Vec3<T>(T(0));
+}
+
+// Every triangle writes its K contributions once, the corners are then stable-sorted by vertex and each
+// vertex sums its own segment. Memory stays linear in the triangle count whatever the thread count, no two
+// threads write the same vertex, and every vertex adds its triangles in index order so results are reproducible
+template<std::size_t K, std::floating_point T, typename Face, typename Gather>
+void scatter_gather(std::span<const uint32_t> indices, std::size_t vertices, Face &&face, Gather &&gather)
+{
+    const std::size_t triangles = indices.size() / 3;
+    std::vector<Vec3<T>> contributions(triangles * K);
+    std::vector<uint32_t> keys(triangles * 3);
+    std::vector<uint32_t> corners(triangles * 3);
+    parallel_for(triangles, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t t = begin; t < end; ++t) {
+            face(t, contributions.data() + t * K);
+            for (std::size_t c = 3 * t; c < 3 * t + 3; ++c) {
+                keys[c] = indices[c];
+                corners[c] = static_cast<uint32_t>(c);
+            }
+        }
+    });
+    radix_sort(keys, corners);
+
+    parallel_for(vertices, [&](std::size_t begin, std::size_t end) {
+        auto i = static_cast<std::size_t>(std::lower_bound(keys.begin(), keys.end(), static_cast<uint32_t>(begin)) - keys.begin());
+        for (std::size_t v = begin; v < end; ++v) {
+            Vec3<T> sum[K];
+            for (std::size_t k = 0; k < K; ++k) {
+                sum[k] = Vec3<T>(T(0));
+            }
+            for (; i < keys.size() && keys[i] == v; ++i) {
+                const Vec3<T> *c = contributions.data() + corners[i] / 3 * K;
+                for (std::size_t k = 0; k < K; ++k) {
+                    sum[k] += c[k];
+                }
+            }
+            gather(v, sum);
+        }
+    });
+}
+
+} // detail
+
+// Per-Face Kernels
+template<std::floating_point T>
+void face_normals(std::span<const Vec3<T>> positions, std::span<const uint32_t> indices, std::span<Vec3<T>> out)
+{
+    parallel_for(indices.size() / 3, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t t = begin; t < end; ++t) {
+            out[t] = detail::unit_or_zero(detail::face_cross(positions, indices, t));
+        }
+    });
+}
+
+template<std::floating_point T>
+void face_areas(std::span<const Vec3<T>> positions, std::span<const uint32_t> indices, std::span<T> out)
+{
+    parallel_for(indices.size() / 3, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t t = begin; t < end; ++t) {
+            out[t] = T(0.5) * magnitude(detail::face_cross(positions, indices, t));
+        }
+    });
+}
+
+// Reductions, fixed block order so repeated runs agree bit-for-bit
+template<std::floating_point T>
+T surface_area(std::span<const Vec3<T>> positions, std::span<const uint32_t> indices)
+{
+    const T area = parallel_reduce(indices.size() / 3, T(0), [&](std::size_t begin, std::size_t end) {
+        T s = 0;
+        for (std::size_t t = begin; t < end; ++t) {
+            s += magnitude(detail::face_cross(positions, indices, t));
+        }
+        return s;
+    }, std::plus<T>());
+    return T(0.5) * area;
+}
+
+// Empty input gives lo > hi
+template<std::floating_point T>
+Bounds3<T> bounds(std::span<const Vec3<T>> positions)
+{
+    constexpr T inf = std::numeric_limits<T>::max();
+
+    const Bounds3<T> empty { Vec3<T>(inf), Vec3<T>(-inf) };
+    return parallel_reduce(positions.size(), empty, [&](std::size_t begin, std::size_t end) {
+        T l[3] = { inf, inf, inf }, h[3] = { -inf, -inf, -inf };
+        for (std::size_t i = begin; i < end; ++i) {
+            const Vec3<T> &p = positions[i];
+            l[0] = std::min(l[0], p.x);
+            l[1] = std::min(l[1], p.y);
+            l[2] = std::min(l[2], p.z);
+            h[0] = std::max(h[0], p.x);
+            h[1] = std::max(h[1], p.y);
+            h[2] = std::max(h[2], p.z);
+        }
+        return Bounds3<T> { Vec3<T>(l[0], l[1], l[2]), Vec3<T>(h[0], h[1], h[2]) };
+    }, [](const Bounds3<T> &a, const Bounds3<T> &b) {
+        return Bounds3<T> {
+                Vec3<T>(std::min(a.lo.x, b.lo.x), std::min(a.lo.y, b.lo.y), std::min(a.lo.z, b.lo.z)),
+                Vec3<T>(std::max(a.hi.x, b.hi.x), std::max(a.hi.y, b.hi.y), std::max(a.hi.z, b.hi.z)),
+        };
+    });
+}
+
+// Per-Vertex Kernels
+// Area-weighted, the unnormalized face cross product already carries twice the area
+template<std::floating_point T>
+void vertex_normals(std::span<const Vec3<T>> positions, std::span<const uint32_t> indices, std::span<Vec3<T>> out)
+{
+    detail::scatter_gather<1, T>(indices, positions.size(), [&](std::size_t t, Vec3<T> *out) {
+        out[0] = detail::face_cross(positions, indices, t);
+    }, [&](std::size_t v, const Vec3<T> *sum) {
+        out[v] = detail::unit_or_zero(sum[0]);
+    });
+}
+
+// MikkTSpace-style per-vertex tangent frames, xyz is the tangent orthogonalized against the vertex normal
+// and w = +-1 the handedness so that bitangent = w * cross(normal, tangent). Faces with degenerate
+// texture coordinates contribute nothing
+template<std::floating_point T>
+void tangents(std::span<const Vec3<T>> positions, std::span<const Vec2<T>> uvs, std::span<const Vec3<T>> normals,
+              std::span<const uint32_t> indices, std::span<Vec4<T>> out)
+{
+    detail::scatter_gather<2, T>(indices, positions.size(), [&](std::size_t t, Vec3<T> *out) {
+        const uint32_t i0 = indices[3 * t], i1 = indices[3 * t + 1], i2 = indices[3 * t + 2];
+        const Vec3<T> e1 = positions[i1] - positions[i0];
+        const Vec3<T> e2 = positions[i2] - positions[i0];
+        const T du1 = uvs[i1].x - uvs[i0].x, dv1 = uvs[i1].y - uvs[i0].y;
+        const T du2 = uvs[i2].x - uvs[i0].x, dv2 = uvs[i2].y - uvs[i0].y;
+        const T r = du1 * dv2 - du2 * dv1;
+        const Vec3<T> k(r == 0 ? T(0) : T(1) / r);
+        out[0] = (e1 * Vec3<T>(dv2) - e2 * Vec3<T>(dv1)) * k;
+        out[1] = (e2 * Vec3<T>(du1) - e1 * Vec3<T>(du2)) * k;
+    }, [&](std::size_t v, const Vec3<T> *sum) {
+        const Vec3<T> &n = normals[v];
+        const Vec3<T> t = detail::unit_or_zero(sum[0] - n * Vec3<T>(dot(n, sum[0])));
+        const T w = dot(cross(n, t), sum[1]) < 0 ? T(-1) : T(1);
+        out[v] = Vec4<T>(t, w);
+    });
+}
+
+} // R3::Math
@@ -0,0 +1,119 @@
+#pragma once
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include "types/Vec1.hpp"
+#include "types/Vec2.hpp"
+#include "types/Vec3.hpp"
+
+namespace R3::Math {
+
+// 21 bits per axis packed into a 63-bit key, x in the lowest bit of each triple
+constexpr uint32_t morton_bits = 21;
+
+constexpr uint64_t morton_spread(uint32_t v)
+{
+    uint64_t x = v & 0x1fffff;
+    x = (x | x << 32) & 0x1f00000000ffff;
+    x = (x | x << 16) & 0x1f0000ff0000ff;
+    x = (x | x << 8) & 0x100f00f00f00f00f;
+    x = (x | x << 4) & 0x10c30c30c30c30c3;
+    x = (x | x << 2) & 0x1249249249249249;
+    return x;
+}
+
+constexpr uint32_t morton_compact(uint64_t x)
+{
+    x &= 0x1249249249249249;
+    x = (x ^ (x >> 2)) & 0x10c30c30c30c30c3;
+    x = (x ^ (x >> 4)) & 0x100f00f00f00f00f;
+    x = (x ^ (x >> 8)) & 0x1f0000ff0000ff;
+    x = (x ^ (x >> 16)) & 0x1f00000000ffff;
+    x = (x ^ (x >> 32)) & 0x1fffff;
+    return static_cast<uint32_t>(x);
+}
+
+constexpr uint64_t morton_encode(uint32_t x, uint32_t y, uint32_t z)
+{
+    return morton_spread(x) | morton_spread(y) << 1 | morton_spread(z) << 2;
+}
+
+constexpr std::array<uint32_t, 3> morton_decode(uint64_t key)
+{
+    return { morton_compact(key), morton_compact(key >> 1), morton_compact(key >> 2) };
+}
+
+// Skilling's transpose form, the Hilbert index is the transposed axes interleaved
+constexpr uint64_t hilbert_encode(uint32_t x, uint32_t y, uint32_t z)
+{
+    uint32_t X[3] = { x, y, z };
+    constexpr uint32_t M = 1u << (morton_bits - 1);
+
+    for (uint32_t Q = M; Q > 1; Q >>= 1) {
+        const uint32_t P = Q - 1;
+        for (auto &Xi : X) {
+            if (Xi & Q) {
+                X[0] ^= P;
+            } else {
+                const uint32_t t = (X[0] ^ Xi) & P;
+                X[0] ^= t;
+                Xi ^= t;
+            }
+        }
+    }
+
+    X[1] ^= X[0];
+    X[2] ^= X[1];
+    uint32_t t = 0;
+    for (uint32_t Q = M; Q > 1; Q >>= 1) {
+        if (X[2] & Q) {
+            t ^= Q - 1;
+        }
+    }
+    for (auto &Xi : X) {
+        Xi ^= t;
+    }
+
+    return morton_encode(X[2], X[1], X[0]);
+}
+
+constexpr std::array<uint32_t, 3> hilbert_decode(uint64_t key)
+{
+    const auto m = morton_decode(key);
+    uint32_t X[3] = { m[2], m[1], m[0] };
+    constexpr uint32_t N = 2u << (morton_bits - 1);
+
+    uint32_t t = X[2] >> 1;
+    X[2] ^= X[1];
+    X[1] ^= X[0];
+    X[0] ^= t;
+
+    for (uint32_t Q = 2; Q != N; Q <<= 1) {
+        const uint32_t P = Q - 1;
+        for (int i = 2; i >= 0; --i) {
+            if (X[i] & Q) {
+                X[0] ^= P;
+            } else {
+                t = (X[0] ^ X[i]) & P;
+                X[0] ^= t;
+                X[i] ^= t;
+            }
+        }
+    }
+
+    return { X[0], X[1], X[2] };
+}
+
+// Maps p inside [lo, hi] onto the 21-bit integer lattice used by the encoders
+template<std::floating_point T>
+constexpr std::array<uint32_t, 3> quantize(const Vec3<T> &p, const Vec3<T> &lo, const Vec3<T> &hi)
+{
+    constexpr T cells = static_cast<T>((1u << morton_bits) - 1);
+    const auto axis = [](T v, T l, T h) {
+        const T s = h > l ? (v - l) / (h - l) : T(0);
+        return static_cast<uint32_t>(std::clamp(s, T(0), T(1)) * cells);
+    };
+    return { axis(p.x, lo.x, hi.x), axis(p.y, lo.y, hi.y), axis(p.z, lo.z, hi.z) };
+}
+
+} // R3::Math
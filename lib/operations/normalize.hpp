@@ -0,0 +1,17 @@
+#pragma once
+#include "types/Vec1.hpp"
+#include "types/Vec2.hpp"
+#include "types/Vec3.hpp"
+#include "types/Vec4.hpp"
+#include "dot.hpp"
+#include "magnitude.hpp"
+
+namespace R3::Math {
+
+template<typename T>
+constexpr T normalize(const T &v) requires (requires(const T &_v) { dot(_v, _v); })
+{
+    return v / T(magnitude(v));
+}
+
+} // R3::Math
@@ -0,0 +1,53 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+namespace R3::Math {
+
+template<typename F>
+void parallel_for(std::size_t n, F &&f, std::size_t grain = 4096)
+{
+    const std::size_t workers = std::max(1u, std::thread::hardware_concurrency());
+    const std::size_t chunks = std::min(workers, (n + grain - 1) / std::max<std::size_t>(grain, 1));
+
+    if (chunks <= 1) {
+        f(std::size_t(0), n);
+        return;
+    }
+
+    std::vector<std::thread> threads;
+    threads.reserve(chunks - 1);
+    for (std::size_t c = 1; c < chunks; ++c) {
+        threads.emplace_back([&f, n, c, chunks] {
+            f(n * c / chunks, n * (c + 1) / chunks);
+        });
+    }
+    f(std::size_t(0), n / chunks);
+
+    for (auto &t : threads) {
+        t.join();
+    }
+}
+
+// Reduction over fixed-size blocks, the block partials are combined in block order so the result does not
+// depend on the thread count or on which thread finishes first
+template<typename R, typename Map, typename Combine>
+R parallel_reduce(std::size_t n, R init, Map &&map, Combine &&combine, std::size_t block = 4096)
+{
+    const std::size_t blocks = (n + block - 1) / block;
+    std::vector<R> partials(blocks, init);
+    parallel_for(blocks, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t b = begin; b < end; ++b) {
+            partials[b] = map(b * block, std::min(n, (b + 1) * block));
+        }
+    }, 1);
+
+    for (const auto &p : partials) {
+        init = combine(init, p);
+    }
+    return init;
+}
+
+} // R3::Math
@@ -0,0 +1,105 @@
+#pragma once
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstdint>
+#include <numeric>
+#include <span>
+#include <thread>
+#include <vector>
+#include "parallel.hpp"
+
+namespace R3::Math {
+
+namespace detail {
+
+// Stable LSD radix sort of keys carrying values along, byte digits with per-thread histograms
+template<std::unsigned_integral K>
+void radix_sort_keys(std::span<K> keys, std::span<uint32_t> values)
+{
+    const std::size_t n = keys.size();
+    const std::size_t chunks = std::clamp<std::size_t>(n / 65536, 1, std::max(1u, std::thread::hardware_concurrency()));
+
+    std::vector<K> key_tmp(n);
+    std::vector<uint32_t> value_tmp(n);
+    std::vector<std::array<std::size_t, 256>> histograms(chunks);
+    std::span<K> src_keys = keys, dst_keys = key_tmp;
+    std::span<uint32_t> src_values = values, dst_values = value_tmp;
+
+    for (uint32_t shift = 0; shift < 8 * sizeof(K); shift += 8) {
+        parallel_for(chunks, [&](std::size_t begin, std::size_t end) {
+            for (std::size_t c = begin; c < end; ++c) {
+                auto &h = histograms[c];
+                h.fill(0);
+                for (std::size_t i = n * c / chunks; i < n * (c + 1) / chunks; ++i) {
+                    ++h[(src_keys[i] >> shift) & 0xff];
+                }
+            }
+        }, 1);
+
+        // A digit shared by every key leaves the order unchanged
+        std::size_t offset = 0;
+        bool trivial = false;
+        for (std::size_t d = 0; d < 256; ++d) {
+            std::size_t total = 0;
+            for (auto &h : histograms) {
+                const std::size_t count = h[d];
+                h[d] = offset + total;
+                total += count;
+            }
+            trivial |= total == n;
+            offset += total;
+        }
+        if (trivial) {
+            continue;
+        }
+
+        parallel_for(chunks, [&](std::size_t begin, std::size_t end) {
+            for (std::size_t c = begin; c < end; ++c) {
+                auto &h = histograms[c];
+                for (std::size_t i = n * c / chunks; i < n * (c + 1) / chunks; ++i) {
+                    const std::size_t to = h[(src_keys[i] >> shift) & 0xff]++;
+                    dst_keys[to] = src_keys[i];
+                    dst_values[to] = src_values[i];
+                }
+            }
+        }, 1);
+
+        std::swap(src_keys, dst_keys);
+        std::swap(src_values, dst_values);
+    }
+
+    if (src_keys.data() != keys.data()) {
+        std::copy(src_keys.begin(), src_keys.end(), keys.begin());
+        std::copy(src_values.begin(), src_values.end(), values.begin());
+    }
+}
+
+} // detail
+
+// 32-bit keys need half the memory and half the passes, use them for vertex and bucket ids
+inline void radix_sort(std::span<uint32_t> keys, std::span<uint32_t> values)
+{
+    detail::radix_sort_keys(keys, values);
+}
+
+inline void radix_sort(std::span<uint64_t> keys, std::span<uint32_t> values)
+{
+    detail::radix_sort_keys(keys, values);
+}
+
+// Gathers data[order[i]] into slot i
+template<std::ranges::contiguous_range R>
+void apply_permutation(std::span<const uint32_t> order, R &data)
+{
+    using V = std::ranges::range_value_t<R>;
+    const std::vector<V> src(std::ranges::begin(data), std::ranges::end(data));
+    auto *dst = std::ranges::data(data);
+    parallel_for(order.size(), [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) {
+            dst[i] = src[order[i]];
+        }
+    });
+}
+
+} // R3::Math
@@ -0,0 +1,167 @@
+#pragma once
+#include <algorithm>
+#include <cmath>
+#include <concepts>
+#include <cstdint>
+#include <numbers>
+#include <span>
+#include "types/Vec1.hpp"
+#include "types/Vec2.hpp"
+#include "types/Vec3.hpp"
+#include "types/VecView.hpp"
+#include "types/Philox.hpp"
+#include "parallel.hpp"
+
+namespace R3::Math {
+
+namespace detail {
+
+// Every mapping takes exactly two uniforms, so sample i always consumes generator output first + i
+template<std::floating_point T>
+void map_disk(T u1, T u2, T *p)
+{
+    const T r = std::sqrt(u1);
+    const T phi = 2 * std::numbers::pi_v<T> * u2;
+    p[0] = r * std::cos(phi);
+    p[1] = r * std::sin(phi);
+}
+
+template<std::floating_point T>
+void map_sphere(T u1, T u2, T *p)
+{
+    const T z = 1 - 2 * u1;
+    const T r = std::sqrt(std::max(T(0), 1 - z * z));
+    const T phi = 2 * std::numbers::pi_v<T> * u2;
+    p[0] = r * std::cos(phi);
+    p[1] = r * std::sin(phi);
+    p[2] = z;
+}
+
+template<std::floating_point T>
+void map_hemisphere(T u1, T u2, T *p)
+{
+    map_sphere(T(0.5) * u1, u2, p);
+}
+
+// Malley's method, a uniform disk point lifted onto the hemisphere
+template<std::floating_point T>
+void map_cosine_hemisphere(T u1, T u2, T *p)
+{
+    map_disk(u1, u2, p);
+    p[2] = std::sqrt(std::max(T(0), 1 - u1));
+}
+
+// Square-root barycentric warp onto the triangle (a, b, c)
+template<std::floating_point T>
+auto map_triangle(const Vec3<T> &a, const Vec3<T> &b, const Vec3<T> &c)
+{
+    return [a, b, c](T u1, T u2, T *p) {
+        const T su = std::sqrt(u1);
+        const T wa = 1 - su, wb = u2 * su, wc = 1 - wa - wb;
+        p[0] = wa * a.x + wb * b.x + wc * c.x;
+        p[1] = wa * a.y + wb * b.y + wc * c.y;
+        p[2] = wa * a.z + wb * b.z + wc * c.z;
+    };
+}
+
+template<std::floating_point T, std::size_t N, typename Map, typename Store>
+void fill(const Philox &rng, uint64_t first, std::size_t count, Map &&map, Store &&store)
+{
+    parallel_for(count, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) {
+            const auto u = rng.uniform2<T>(first + i);
+            T p[N];
+            map(u[0], u[1], p);
+            store(i, p);
+        }
+    });
+}
+
+template<std::floating_point T, std::size_t N, typename Map>
+void fill(const Philox &rng, uint64_t first, const VecView<T, N> &out, Map &&map)
+{
+    fill<T, N>(rng, first, out.size(), map, [&](std::size_t i, const T *p) {
+        T *o = out(i);
+        for (std::size_t j = 0; j < N; ++j) {
+            o[j] = p[j];
+        }
+    });
+}
+
+template<std::floating_point T, std::size_t N, typename Map>
+void fill(const Philox &rng, uint64_t first, const std::span<T> (&out)[N], Map &&map)
+{
+    fill<T, N>(rng, first, out[0].size(), map, [&](std::size_t i, const T *p) {
+        for (std::size_t j = 0; j < N; ++j) {
+            out[j][i] = p[j];
+        }
+    });
+}
+
+} // detail
+
+// Uniform Samplers, out[i] is drawn from rng output first + i
+template<std::floating_point T>
+void sample_disk(const Philox &rng, uint64_t first, const VecView<T, 2> &out)
+{
+    detail::fill<T, 2>(rng, first, out, detail::map_disk<T>);
+}
+
+template<std::floating_point T>
+void sample_disk(const Philox &rng, uint64_t first, std::span<T> x, std::span<T> y)
+{
+    detail::fill<T, 2>(rng, first, { x, y }, detail::map_disk<T>);
+}
+
+template<std::floating_point T>
+void sample_sphere(const Philox &rng, uint64_t first, const VecView<T, 3> &out)
+{
+    detail::fill<T, 3>(rng, first, out, detail::map_sphere<T>);
+}
+
+template<std::floating_point T>
+void sample_sphere(const Philox &rng, uint64_t first, std::span<T> x, std::span<T> y, std::span<T> z)
+{
+    detail::fill<T, 3>(rng, first, { x, y, z }, detail::map_sphere<T>);
+}
+
+// Hemispheres are about +z
+template<std::floating_point T>
+void sample_hemisphere(const Philox &rng, uint64_t first, const VecView<T, 3> &out)
+{
+    detail::fill<T, 3>(rng, first, out, detail::map_hemisphere<T>);
+}
+
+template<std::floating_point T>
+void sample_hemisphere(const Philox &rng, uint64_t first, std::span<T> x, std::span<T> y, std::span<T> z)
+{
+    detail::fill<T, 3>(rng, first, { x, y, z }, detail::map_hemisphere<T>);
+}
+
+template<std::floating_point T>
+void sample_cosine_hemisphere(const Philox &rng, uint64_t first, const VecView<T, 3> &out)
+{
+    detail::fill<T, 3>(rng, first, out, detail::map_cosine_hemisphere<T>);
+}
+
+template<std::floating_point T>
+void sample_cosine_hemisphere(const Philox &rng, uint64_t first, std::span<T> x, std::span<T> y, std::span<T> z)
+{
+    detail::fill<T, 3>(rng, first, { x, y, z }, detail::map_cosine_hemisphere<T>);
+}
+
+template<std::floating_point T>
+void sample_triangle(const Philox &rng, uint64_t first, const Vec3<T> &a, const Vec3<T> &b, const Vec3<T> &c,
+                     const VecView<T, 3> &out)
+{
+    detail::fill<T, 3>(rng, first, out, detail::map_triangle(a, b, c));
+}
+
+template<std::floating_point T>
+void sample_triangle(const Philox &rng, uint64_t first, const Vec3<T> &a, const Vec3<T> &b, const Vec3<T> &c,
+                     std::span<T> x, std::span<T> y, std::span<T> z)
+{
+    detail::fill<T, 3>(rng, first, { x, y, z }, detail::map_triangle(a, b, c));
+}
+
+} // R3::Math
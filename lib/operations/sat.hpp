@@ -0,0 +1,104 @@
+#pragma once
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <limits>
+#include <span>
+#include "types/Vec1.hpp"
+#include "types/Vec2.hpp"
+#include "types/Vec3.hpp"
+#include "types/Shapes.hpp"
+#include "dot.hpp"
+#include "cross.hpp"
+#include "parallel.hpp"
+
+namespace R3::Math {
+
+// Smallest overlap over the 15 box-box axes, negative depth is a separation along normal (a towards b)
+template<std::floating_point T>
+struct BoxContact
+{
+    bool intersecting;
+    T depth;
+    Vec3<T> normal;
+};
+
+// Gottschalk's OBB test, every axis is evaluated and the minimum picked by select so pairs cost the same
+template<std::floating_point T>
+BoxContact<T> sat(const Box<T> &a, const Box<T> &b)
+{
+    constexpr T eps = std::numeric_limits<T>::epsilon() * 16;
+    constexpr T skip = std::numeric_limits<T>::max();
+
+    const Vec3<T> *A = a.axes.cols;
+    const Vec3<T> *B = b.axes.cols;
+    const T ea[3] = { a.half.x, a.half.y, a.half.z };
+    const T eb[3] = { b.half.x, b.half.y, b.half.z };
+    const Vec3<T> d = b.center - a.center;
+    const T t[3] = { dot(d, A[0]), dot(d, A[1]), dot(d, A[2]) };
+
+    T R[3][3], absR[3][3];
+    for (std::size_t i = 0; i < 3; ++i) {
+        for (std::size_t j = 0; j < 3; ++j) {
+            R[i][j] = dot(A[i], B[j]);
+            absR[i][j] = std::abs(R[i][j]) + eps;
+        }
+    }
+
+    T best = skip;
+    std::size_t best_axis = 0;
+    const auto consider = [&](T depth, std::size_t axis) {
+        best_axis = depth < best ? axis : best_axis;
+        best = depth < best ? depth : best;
+    };
+
+    for (std::size_t i = 0; i < 3; ++i) {
+        const T rb = eb[0] * absR[i][0] + eb[1] * absR[i][1] + eb[2] * absR[i][2];
+        consider(ea[i] + rb - std::abs(t[i]), i);
+    }
+    for (std::size_t j = 0; j < 3; ++j) {
+        const T ra = ea[0] * absR[0][j] + ea[1] * absR[1][j] + ea[2] * absR[2][j];
+        const T s = t[0] * R[0][j] + t[1] * R[1][j] + t[2] * R[2][j];
+        consider(ra + eb[j] - std::abs(s), 3 + j);
+    }
+    for (std::size_t i = 0; i < 3; ++i) {
+        const std::size_t i1 = (i + 1) % 3, i2 = (i + 2) % 3;
+        for (std::size_t j = 0; j < 3; ++j) {
+            const std::size_t j1 = (j + 1) % 3, j2 = (j + 2) % 3;
+            const T ra = ea[i1] * absR[i2][j] + ea[i2] * absR[i1][j];
+            const T rb = eb[j1] * absR[i][j2] + eb[j2] * absR[i][j1];
+            const T s = t[i2] * R[i1][j] - t[i1] * R[i2][j];
+            const T len = std::sqrt(std::max(T(0), 1 - R[i][j] * R[i][j]));
+            // Near-parallel edges give no axis, the face axes already cover them
+            consider(len > eps ? (ra + rb - std::abs(s)) / len : skip, 6 + i * 3 + j);
+        }
+    }
+
+    Vec3<T> normal;
+    if (best_axis < 3) {
+        normal = A[best_axis];
+    } else if (best_axis < 6) {
+        normal = B[best_axis - 3];
+    } else {
+        const Vec3<T> c = cross(A[(best_axis - 6) / 3], B[(best_axis - 6) % 3]);
+        normal = c / Vec3<T>(std::sqrt(dot(c, c)));
+    }
+    if (dot(normal, d) < 0) {
+        normal = -normal;
+    }
+
+    return BoxContact<T> { best >= 0, best, normal };
+}
+
+// Batch Queries, pair i is (a[i], b[i])
+template<std::floating_point T>
+void sat(std::span<const Box<T>> a, std::span<const Box<T>> b, std::span<BoxContact<T>> out)
+{
+    parallel_for(out.size(), [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) {
+            out[i] = sat(a[i], b[i]);
+        }
+    }, 1024);
+}
+
+} // R3::Math
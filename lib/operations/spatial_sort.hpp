@@ -0,0 +1,80 @@
+#pragma once
+#include <cstdint>
+#include <limits>
+#include <mutex>
+#include <numeric>
+#include <ranges>
+#include <span>
+#include <vector>
+#include "types/Vec1.hpp"
+#include "types/Vec2.hpp"
+#include "types/Vec3.hpp"
+#include "types/Vec4.hpp"
+#include "morton.hpp"
+#include "parallel.hpp"
+#include "radix_sort.hpp"
+
+namespace R3::Math {
+
+enum class SpaceFillingCurve
+{
+    Morton,
+    Hilbert,
+};
+
+// Keys are taken from x, y, z so Vec4 arrays sort by their spatial part
+template<std::ranges::contiguous_range R>
+void spatial_keys(const R &points, std::span<uint64_t> keys, SpaceFillingCurve curve = SpaceFillingCurve::Morton)
+{
+    using T = decltype(std::ranges::data(points)->x);
+    const auto *p = std::ranges::data(points);
+    const std::size_t n = std::ranges::size(points);
+
+    Vec3<T> lo(std::numeric_limits<T>::max());
+    Vec3<T> hi(std::numeric_limits<T>::lowest());
+    std::mutex bounds;
+    parallel_for(n, [&](std::size_t begin, std::size_t end) {
+        Vec3<T> l(std::numeric_limits<T>::max());
+        Vec3<T> h(std::numeric_limits<T>::lowest());
+        for (std::size_t i = begin; i < end; ++i) {
+            l = Vec3<T>(std::min(l.x, p[i].x), std::min(l.y, p[i].y), std::min(l.z, p[i].z));
+            h = Vec3<T>(std::max(h.x, p[i].x), std::max(h.y, p[i].y), std::max(h.z, p[i].z));
+        }
+        const std::lock_guard lock(bounds);
+        lo = Vec3<T>(std::min(lo.x, l.x), std::min(lo.y, l.y), std::min(lo.z, l.z));
+        hi = Vec3<T>(std::max(hi.x, h.x), std::max(hi.y, h.y), std::max(hi.z, h.z));
+    });
+
+    parallel_for(n, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) {
+            const auto q = quantize(Vec3<T>(p[i].x, p[i].y, p[i].z), lo, hi);
+            keys[i] = curve == SpaceFillingCurve::Morton
+                    ? morton_encode(q[0], q[1], q[2])
+                    : hilbert_encode(q[0], q[1], q[2]);
+        }
+    });
+}
+
+template<std::ranges::contiguous_range R>
+std::vector<uint32_t> spatial_order(const R &points, SpaceFillingCurve curve = SpaceFillingCurve::Morton)
+{
+    const std::size_t n = std::ranges::size(points);
+    std::vector<uint64_t> keys(n);
+    std::vector<uint32_t> order(n);
+    spatial_keys(points, keys, curve);
+    std::iota(order.begin(), order.end(), uint32_t(0));
+    radix_sort(keys, order);
+    return order;
+}
+
+// Reorders points and any parallel payload arrays along the curve
+template<std::ranges::contiguous_range R, std::ranges::contiguous_range... Payloads>
+std::vector<uint32_t> spatial_sort(R &points, SpaceFillingCurve curve, Payloads &...payloads)
+{
+    auto order = spatial_order(points, curve);
+    apply_permutation(order, points);
+    (apply_permutation(order, payloads), ...);
+    return order;
+}
+
+} // R3::Math
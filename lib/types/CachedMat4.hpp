@@ -0,0 +1,99 @@
+#pragma once
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include "types/Vec4.hpp"
+#include "types/Mat.hpp"
+#include "operations/parallel.hpp"
+
+namespace R3::Math {
+
+// Matrix with its inverse, normal matrix (transpose of the inverse) and determinant derived on first read.
+// Every mutation bumps the version, a lazy read writes the cache so a dirty object must not be read from
+// several threads at once, refresh the batch first
+template<std::floating_point T>
+class CachedMat4
+{
+public:
+    CachedMat4()
+            : CachedMat4(Mat4<T>::identity())
+    {}
+    explicit CachedMat4(const Mat4<T> &m)
+            : m(m),
+              version_id(1),
+              cached_id(0)
+    {}
+
+    // Mutation
+    CachedMat4 &operator=(const Mat4<T> &m) {
+        this->m = m;
+        ++this->version_id;
+        return *this;
+    }
+    void set(std::size_t r, std::size_t c, T value) {
+        this->m(r, c) = value;
+        ++this->version_id;
+    }
+    template<typename F>
+    void modify(F &&f) {
+        f(this->m);
+        ++this->version_id;
+    }
+
+    [[nodiscard]] const Mat4<T> &matrix() const {
+        return this->m;
+    }
+    [[nodiscard]] uint64_t version() const {
+        return this->version_id;
+    }
+    [[nodiscard]] bool dirty() const {
+        return this->cached_id != this->version_id;
+    }
+
+    // Derived Values, undefined for singular matrices
+    [[nodiscard]] const Mat4<T> &inverse() const {
+        this->refresh();
+        return this->inv;
+    }
+    [[nodiscard]] const Mat4<T> &normal_matrix() const {
+        this->refresh();
+        return this->normal;
+    }
+    [[nodiscard]] T determinant() const {
+        this->refresh();
+        return this->det;
+    }
+
+    // All three come from one adjugate
+    void refresh() const {
+        if (!this->dirty()) {
+            return;
+        }
+        const Mat4<T> adj = this->m.adjugate();
+        this->det = this->m.determinant(adj);
+        this->inv = adj * (T(1) / this->det);
+        this->normal = this->inv.transpose();
+        this->cached_id = this->version_id;
+    }
+
+private:
+    Mat4<T> m;
+    uint64_t version_id;
+    mutable uint64_t cached_id;
+    mutable Mat4<T> inv, normal;
+    mutable T det;
+};
+
+// Recomputes the dirty entries only, afterwards every entry can be read concurrently
+template<std::floating_point T>
+void refresh(std::span<const CachedMat4<T>> m)
+{
+    parallel_for(m.size(), [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) {
+            m[i].refresh();
+        }
+    }, 1024);
+}
+
+} // R3::Math
@@ -0,0 +1,221 @@
+#pragma once
+#include <algorithm>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <span>
+#include <stdexcept>
+#include <vector>
+#include "types/VecView.hpp"
+#include "operations/parallel.hpp"
+
+namespace R3::Math {
+
+// Cubic segment held in power basis, every spline form reduces to this so evaluation is one Horner chain
+template<std::floating_point T, std::size_t N>
+class Cubic
+{
+public:
+    using value_type = VecOf_t<T, N>;
+
+    Cubic() = default;
+
+    static Cubic bezier(const value_type &p0, const value_type &p1, const value_type &p2, const value_type &p3) {
+        Cubic s;
+        for (std::size_t j = 0; j < N; ++j) {
+            const T q0 = component(p0, j), q1 = component(p1, j), q2 = component(p2, j), q3 = component(p3, j);
+            s.a[j] = q0;
+            s.b[j] = 3 * (q1 - q0);
+            s.c[j] = 3 * (q0 - 2 * q1 + q2);
+            s.d[j] = -q0 + 3 * q1 - 3 * q2 + q3;
+        }
+        return s;
+    }
+    static Cubic hermite(const value_type &p0, const value_type &m0, const value_type &p1, const value_type &m1) {
+        Cubic s;
+        for (std::size_t j = 0; j < N; ++j) {
+            const T q0 = component(p0, j), t0 = component(m0, j), q1 = component(p1, j), t1 = component(m1, j);
+            s.a[j] = q0;
+            s.b[j] = t0;
+            s.c[j] = -3 * q0 - 2 * t0 + 3 * q1 - t1;
+            s.d[j] = 2 * q0 + t0 - 2 * q1 + t1;
+        }
+        return s;
+    }
+    // Uniform Catmull-Rom segment running from p1 to p2
+    static Cubic catmull_rom(const value_type &p0, const value_type &p1, const value_type &p2, const value_type &p3) {
+        Cubic s;
+        for (std::size_t j = 0; j < N; ++j) {
+            const T q0 = component(p0, j), q1 = component(p1, j), q2 = component(p2, j), q3 = component(p3, j);
+            s.a[j] = q1;
+            s.b[j] = T(0.5) * (q2 - q0);
+            s.c[j] = T(0.5) * (2 * q0 - 5 * q1 + 4 * q2 - q3);
+            s.d[j] = T(0.5) * (-q0 + 3 * q1 - 3 * q2 + q3);
+        }
+        return s;
+    }
+
+    // Single Evaluation
+    constexpr value_type position(T t) const {
+        T p[N];
+        this->position(t, p);
+        return load_vec<T, N>(p);
+    }
+    constexpr value_type tangent(T t) const {
+        T p[N];
+        this->tangent(t, p);
+        return load_vec<T, N>(p);
+    }
+
+    // Batch Evaluation
+    void positions(std::span<const T> ts, const VecView<T, N> &out) const {
+        parallel_for(ts.size(), [&](std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; ++i) {
+                this->position(ts[i], out(i));
+            }
+        });
+    }
+    void tangents(std::span<const T> ts, const VecView<T, N> &out) const {
+        parallel_for(ts.size(), [&](std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; ++i) {
+                this->tangent(ts[i], out(i));
+            }
+        });
+    }
+    // out[i] = curves[i] at ts[i], a single parameter is broadcast over every curve
+    static void positions(std::span<const Cubic> curves, std::span<const T> ts, const VecView<T, N> &out) {
+        const bool broadcast = ts.size() == 1;
+        parallel_for(curves.size(), [&](std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; ++i) {
+                curves[i].position(ts[broadcast ? 0 : i], out(i));
+            }
+        });
+    }
+    static void tangents(std::span<const Cubic> curves, std::span<const T> ts, const VecView<T, N> &out) {
+        const bool broadcast = ts.size() == 1;
+        parallel_for(curves.size(), [&](std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; ++i) {
+                curves[i].tangent(ts[broadcast ? 0 : i], out(i));
+            }
+        });
+    }
+
+    // Adaptive subdivision until each piece deviates from its chord by at most tolerance
+    void flatten(T tolerance, std::vector<value_type> &out, std::size_t max_depth = 16) const {
+        T q[4][N];
+        for (std::size_t j = 0; j < N; ++j) {
+            q[0][j] = this->a[j];
+            q[1][j] = this->a[j] + this->b[j] / 3;
+            q[2][j] = this->a[j] + (2 * this->b[j] + this->c[j]) / 3;
+            q[3][j] = this->a[j] + this->b[j] + this->c[j] + this->d[j];
+        }
+        out.push_back(load_vec<T, N>(q[0]));
+        flatten(q, 16 * tolerance * tolerance, max_depth, out);
+    }
+
+private:
+    constexpr void position(T t, T *out) const {
+        for (std::size_t j = 0; j < N; ++j) {
+            out[j] = this->a[j] + t * (this->b[j] + t * (this->c[j] + t * this->d[j]));
+        }
+    }
+    constexpr void tangent(T t, T *out) const {
+        for (std::size_t j = 0; j < N; ++j) {
+            out[j] = this->b[j] + t * (2 * this->c[j] + t * 3 * this->d[j]);
+        }
+    }
+
+    static void flatten(const T (&q)[4][N], T limit, std::size_t depth, std::vector<value_type> &out) {
+        T u = 0, v = 0;
+        for (std::size_t j = 0; j < N; ++j) {
+            const T uj = 3 * q[1][j] - 2 * q[0][j] - q[3][j];
+            const T vj = 3 * q[2][j] - q[0][j] - 2 * q[3][j];
+            u += uj * uj;
+            v += vj * vj;
+        }
+        if (depth == 0 || std::max(u, v) <= limit) {
+            out.push_back(load_vec<T, N>(q[3]));
+            return;
+        }
+
+        T left[4][N], right[4][N];
+        for (std::size_t j = 0; j < N; ++j) {
+            const T p01 = (q[0][j] + q[1][j]) / 2, p12 = (q[1][j] + q[2][j]) / 2, p23 = (q[2][j] + q[3][j]) / 2;
+            const T p012 = (p01 + p12) / 2, p123 = (p12 + p23) / 2;
+            const T mid = (p012 + p123) / 2;
+            left[0][j] = q[0][j];
+            left[1][j] = p01;
+            left[2][j] = p012;
+            left[3][j] = mid;
+            right[0][j] = mid;
+            right[1][j] = p123;
+            right[2][j] = p23;
+            right[3][j] = q[3][j];
+        }
+        flatten(left, limit, depth - 1, out);
+        flatten(right, limit, depth - 1, out);
+    }
+
+    T a[N], b[N], c[N], d[N];
+};
+
+// Cumulative chord lengths at uniform parameters, for constant-speed traversal
+template<std::floating_point T>
+class ArcLengthTable
+{
+public:
+    ArcLengthTable() = default;
+    template<std::size_t N>
+    explicit ArcLengthTable(const Cubic<T, N> &curve, std::size_t samples = 64) {
+        if (samples == 0) {
+            throw std::invalid_argument("ArcLengthTable needs at least one sample");
+        }
+        std::vector<T> ts(samples + 1);
+        for (std::size_t i = 0; i <= samples; ++i) {
+            ts[i] = static_cast<T>(i) / static_cast<T>(samples);
+        }
+        std::vector<T> points(N * (samples + 1));
+        curve.positions(ts, VecView<T, N>(points.data(), samples + 1));
+
+        this->lengths.assign(samples + 1, T(0));
+        for (std::size_t i = 1; i <= samples; ++i) {
+            T d2 = 0;
+            for (std::size_t j = 0; j < N; ++j) {
+                const T d = points[i * N + j] - points[(i - 1) * N + j];
+                d2 += d * d;
+            }
+            this->lengths[i] = this->lengths[i - 1] + std::sqrt(d2);
+        }
+    }
+
+    [[nodiscard]] constexpr T length() const {
+        return this->lengths.empty() ? T(0) : this->lengths.back();
+    }
+
+    // Parameter t at which the curve has travelled arc length s, 0 for a default-constructed table
+    [[nodiscard]] T parameter(T s) const {
+        if (this->lengths.empty()) {
+            return T(0);
+        }
+        const std::size_t samples = this->lengths.size() - 1;
+        s = std::clamp(s, T(0), this->length());
+        const auto it = std::upper_bound(this->lengths.begin(), this->lengths.end(), s);
+        const std::size_t i = std::min<std::size_t>(std::max<std::ptrdiff_t>(it - this->lengths.begin(), 1), samples);
+        const T span = this->lengths[i] - this->lengths[i - 1];
+        const T f = span > 0 ? (s - this->lengths[i - 1]) / span : T(0);
+        return (static_cast<T>(i - 1) + f) / static_cast<T>(samples);
+    }
+
+    void parameters(std::span<const T> s, std::span<T> out) const {
+        parallel_for(s.size(), [&](std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; ++i) {
+                out[i] = this->parameter(s[i]);
+            }
+        });
+    }
+
+private:
+    std::vector<T> lengths;
+};
+
+} // R3::Math
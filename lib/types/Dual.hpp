@@ -0,0 +1,242 @@
+#pragma once
+#include <cmath>
+#include <compare>
+#include <concepts>
+#include <cstddef>
+#include <type_traits>
+#include "types/Scalar.hpp"
+
+namespace R3::Math {
+
+// Forward-mode dual number, value plus N partial derivatives kept contiguous so every rule is an N-wide loop
+template<std::floating_point T, std::size_t N>
+struct Dual
+{
+    T value;
+    T tangent[N];
+
+    Dual() = default;
+    Dual(const Dual &d) = default;
+    Dual(Dual &&d) noexcept = default;
+    Dual &operator=(const Dual &d) = default;
+    template<typename U> requires std::is_arithmetic_v<U>
+    constexpr Dual(U value)
+            : value(static_cast<T>(value)),
+              tangent{}
+    {}
+
+    // Seeds the i-th independent variable
+    static constexpr Dual variable(T value, std::size_t i) {
+        Dual d(value);
+        d.tangent[i] = T(1);
+        return d;
+    }
+
+    // Unary Constant Operators
+    constexpr Dual operator+() const {
+        return *this;
+    }
+    constexpr Dual operator-() const {
+        Dual r;
+        r.value = -this->value;
+        for (std::size_t i = 0; i < N; ++i) {
+            r.tangent[i] = -this->tangent[i];
+        }
+        return r;
+    }
+
+    // Unary Arithmetic Operators
+    constexpr Dual &operator+=(const Dual &d) {
+        this->value += d.value;
+        for (std::size_t i = 0; i < N; ++i) {
+            this->tangent[i] += d.tangent[i];
+        }
+        return *this;
+    }
+    constexpr Dual &operator+=(T s) {
+        this->value += s;
+        return *this;
+    }
+    constexpr Dual &operator-=(const Dual &d) {
+        this->value -= d.value;
+        for (std::size_t i = 0; i < N; ++i) {
+            this->tangent[i] -= d.tangent[i];
+        }
+        return *this;
+    }
+    constexpr Dual &operator-=(T s) {
+        this->value -= s;
+        return *this;
+    }
+    constexpr Dual &operator*=(const Dual &d) {
+        for (std::size_t i = 0; i < N; ++i) {
+            this->tangent[i] = this->tangent[i] * d.value + this->value * d.tangent[i];
+        }
+        this->value *= d.value;
+        return *this;
+    }
+    constexpr Dual &operator*=(T s) {
+        this->value *= s;
+        for (std::size_t i = 0; i < N; ++i) {
+            this->tangent[i] *= s;
+        }
+        return *this;
+    }
+    constexpr Dual &operator/=(const Dual &d) {
+        const T inv = T(1) / d.value;
+        const T q = this->value * inv;
+        for (std::size_t i = 0; i < N; ++i) {
+            this->tangent[i] = (this->tangent[i] - q * d.tangent[i]) * inv;
+        }
+        this->value = q;
+        return *this;
+    }
+    constexpr Dual &operator/=(T s) {
+        return *this *= T(1) / s;
+    }
+
+    // Inc and Dec Operations
+    constexpr Dual &operator++() {
+        ++this->value;
+        return *this;
+    }
+    constexpr Dual operator++(int) {
+        const Dual copy = *this;
+        ++this->value;
+        return copy;
+    }
+    constexpr Dual &operator--() {
+        --this->value;
+        return *this;
+    }
+    constexpr Dual operator--(int) {
+        const Dual copy = *this;
+        --this->value;
+        return copy;
+    }
+
+    // Binary Arithmetic Operators
+    friend constexpr Dual operator+(Dual a, const Dual &b) {
+        return a += b;
+    }
+    friend constexpr Dual operator+(Dual a, T s) {
+        return a += s;
+    }
+    friend constexpr Dual operator+(T s, Dual a) {
+        return a += s;
+    }
+    friend constexpr Dual operator-(Dual a, const Dual &b) {
+        return a -= b;
+    }
+    friend constexpr Dual operator-(Dual a, T s) {
+        return a -= s;
+    }
+    friend constexpr Dual operator-(T s, const Dual &a) {
+        return -a + s;
+    }
+    friend constexpr Dual operator*(Dual a, const Dual &b) {
+        return a *= b;
+    }
+    friend constexpr Dual operator*(Dual a, T s) {
+        return a *= s;
+    }
+    friend constexpr Dual operator*(T s, Dual a) {
+        return a *= s;
+    }
+    friend constexpr Dual operator/(Dual a, const Dual &b) {
+        return a /= b;
+    }
+    friend constexpr Dual operator/(Dual a, T s) {
+        return a /= s;
+    }
+    friend constexpr Dual operator/(T s, const Dual &a) {
+        return Dual(s) /= a;
+    }
+
+    // Boolean Operators, derivatives do not take part in comparisons
+    friend constexpr bool operator==(const Dual &a, const Dual &b) {
+        return a.value == b.value;
+    }
+    friend constexpr auto operator<=>(const Dual &a, const Dual &b) {
+        return a.value <=> b.value;
+    }
+};
+
+template<std::floating_point T, std::size_t N>
+struct is_scalar<Dual<T, N>> : std::true_type {};
+
+namespace detail {
+
+// f(a) with f'(a) = slope
+template<std::floating_point T, std::size_t N>
+constexpr Dual<T, N> chain(const Dual<T, N> &a, T value, T slope)
+{
+    Dual<T, N> r;
+    r.value = value;
+    for (std::size_t i = 0; i < N; ++i) {
+        r.tangent[i] = slope * a.tangent[i];
+    }
+    return r;
+}
+
+} // detail
+
+// Elementary Functions
+template<std::floating_point T, std::size_t N>
+Dual<T, N> sqrt(const Dual<T, N> &a)
+{
+    const T s = std::sqrt(a.value);
+    return detail::chain(a, s, T(0.5) / s);
+}
+
+template<std::floating_point T, std::size_t N>
+Dual<T, N> abs(const Dual<T, N> &a)
+{
+    return detail::chain(a, std::abs(a.value), a.value < 0 ? T(-1) : T(1));
+}
+
+template<std::floating_point T, std::size_t N>
+Dual<T, N> sin(const Dual<T, N> &a)
+{
+    return detail::chain(a, std::sin(a.value), std::cos(a.value));
+}
+
+template<std::floating_point T, std::size_t N>
+Dual<T, N> cos(const Dual<T, N> &a)
+{
+    return detail::chain(a, std::cos(a.value), -std::sin(a.value));
+}
+
+template<std::floating_point T, std::size_t N>
+Dual<T, N> exp(const Dual<T, N> &a)
+{
+    const T e = std::exp(a.value);
+    return detail::chain(a, e, e);
+}
+
+template<std::floating_point T, std::size_t N>
+Dual<T, N> log(const Dual<T, N> &a)
+{
+    return detail::chain(a, std::log(a.value), T(1) / a.value);
+}
+
+template<std::floating_point T, std::size_t N>
+Dual<T, N> pow(const Dual<T, N> &a, T p)
+{
+    const T v = std::pow(a.value, p);
+    return detail::chain(a, v, p * std::pow(a.value, p - 1));
+}
+
+template<std::floating_point T, std::size_t N>
+Dual<T, N> atan2(const Dual<T, N> &y, const Dual<T, N> &x)
+{
+    const T inv = T(1) / (x.value * x.value + y.value * y.value);
+    Dual<T, N> r;
+    r.value = std::atan2(y.value, x.value);
+    for (std::size_t i = 0; i < N; ++i) {
+        r.tangent[i] = (x.value * y.tangent[i] - y.value * x.tangent[i]) * inv;
+    }
+    return r;
+}
+
+} // R3::Math
@@ -0,0 +1,221 @@
+#pragma once
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <span>
+#include <thread>
+#include <utility>
+#include <vector>
+#include "types/Vec1.hpp"
+#include "types/Vec2.hpp"
+#include "types/Vec3.hpp"
+#include "operations/parallel.hpp"
+
+namespace R3::Math {
+
+// Implicit balanced k-d tree, the split of range [b, e) is the point at (b + e) / 2 on axis depth % 3
+template<std::floating_point T, std::size_t LeafSize = 16>
+class KdTree
+{
+public:
+    KdTree() = default;
+    explicit KdTree(std::span<const Vec3<T>> points) {
+        this->build(points);
+    }
+
+    void build(std::span<const Vec3<T>> points) {
+        const std::size_t n = points.size();
+        this->index.resize(n);
+        std::iota(this->index.begin(), this->index.end(), uint32_t(0));
+
+        struct Task { std::size_t b, e, depth; };
+        std::vector<Task> tasks = { { 0, n, 0 } };
+        const std::size_t target = 4 * std::max(1u, std::thread::hardware_concurrency());
+
+        // Split the top levels serially until there is enough independent work to go around
+        while (tasks.size() < target) {
+            std::vector<Task> next;
+            bool split = false;
+            for (const auto &t : tasks) {
+                if (t.e - t.b <= 16 * LeafSize) {
+                    next.push_back(t);
+                    continue;
+                }
+                const std::size_t mid = this->partition(points, t.b, t.e, t.depth);
+                next.push_back({ t.b, mid, t.depth + 1 });
+                next.push_back({ mid + 1, t.e, t.depth + 1 });
+                split = true;
+            }
+            tasks = std::move(next);
+            if (!split) {
+                break;
+            }
+        }
+
+        parallel_for(tasks.size(), [&](std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; ++i) {
+                this->build_range(points, tasks[i].b, tasks[i].e, tasks[i].depth);
+            }
+        }, 1);
+
+        for (auto &c : this->coords) {
+            c.resize(n);
+        }
+        parallel_for(n, [&](std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; ++i) {
+                const auto &p = points[this->index[i]];
+                this->coords[0][i] = p.x;
+                this->coords[1][i] = p.y;
+                this->coords[2][i] = p.z;
+            }
+        });
+    }
+
+    [[nodiscard]] constexpr std::size_t size() const {
+        return this->index.size();
+    }
+
+    // Radius Queries
+    void radius_query(const Vec3<T> &c, T radius, std::vector<uint32_t> &out) const {
+        out.clear();
+        const T q[3] = { c.x, c.y, c.z };
+        this->radius_range(q, radius * radius, 0, this->size(), 0, out);
+    }
+
+    void radius_query(std::span<const Vec3<T>> queries, T radius, std::vector<std::vector<uint32_t>> &out) const {
+        out.resize(queries.size());
+        parallel_for(queries.size(), [&](std::size_t begin, std::size_t end) {
+            for (std::size_t q = begin; q < end; ++q) {
+                this->radius_query(queries[q], radius, out[q]);
+            }
+        }, 64);
+    }
+
+    // K-Nearest Queries, results ordered nearest first
+    void knn_query(const Vec3<T> &c, std::size_t k, std::vector<uint32_t> &out) const {
+        out.clear();
+        k = std::min(k, this->size());
+        if (k == 0) {
+            return;
+        }
+
+        const T q[3] = { c.x, c.y, c.z };
+        std::vector<std::pair<T, uint32_t>> heap;
+        heap.reserve(k);
+        this->knn_range(q, k, 0, this->size(), 0, heap);
+
+        std::sort_heap(heap.begin(), heap.end());
+        for (const auto &h : heap) {
+            out.push_back(h.second);
+        }
+    }
+
+    void knn_query(std::span<const Vec3<T>> queries, std::size_t k, std::vector<std::vector<uint32_t>> &out) const {
+        out.resize(queries.size());
+        parallel_for(queries.size(), [&](std::size_t begin, std::size_t end) {
+            for (std::size_t q = begin; q < end; ++q) {
+                this->knn_query(queries[q], k, out[q]);
+            }
+        }, 64);
+    }
+
+private:
+    static constexpr T axis_of(const Vec3<T> &p, std::size_t axis) {
+        return axis == 0 ? p.x : axis == 1 ? p.y : p.z;
+    }
+
+    std::size_t partition(std::span<const Vec3<T>> points, std::size_t b, std::size_t e, std::size_t depth) {
+        const std::size_t mid = (b + e) / 2;
+        const std::size_t axis = depth % 3;
+        std::nth_element(this->index.begin() + b, this->index.begin() + mid, this->index.begin() + e,
+            [&](uint32_t i, uint32_t j) {
+                return axis_of(points[i], axis) < axis_of(points[j], axis);
+            });
+        return mid;
+    }
+
+    void build_range(std::span<const Vec3<T>> points, std::size_t b, std::size_t e, std::size_t depth) {
+        if (e - b <= LeafSize) {
+            return;
+        }
+        const std::size_t mid = this->partition(points, b, e, depth);
+        this->build_range(points, b, mid, depth + 1);
+        this->build_range(points, mid + 1, e, depth + 1);
+    }
+
+    constexpr T distance_squared(const T q[3], std::size_t i) const {
+        const T dx = this->coords[0][i] - q[0];
+        const T dy = this->coords[1][i] - q[1];
+        const T dz = this->coords[2][i] - q[2];
+        return dx * dx + dy * dy + dz * dz;
+    }
+
+    void radius_range(const T q[3], T r2, std::size_t b, std::size_t e, std::size_t depth, std::vector<uint32_t> &out) const {
+        if (e - b <= LeafSize) {
+            for (std::size_t i = b; i < e; ++i) {
+                if (this->distance_squared(q, i) <= r2) {
+                    out.push_back(this->index[i]);
+                }
+            }
+            return;
+        }
+
+        const std::size_t mid = (b + e) / 2;
+        const T diff = q[depth % 3] - this->coords[depth % 3][mid];
+        if (this->distance_squared(q, mid) <= r2) {
+            out.push_back(this->index[mid]);
+        }
+        if (diff <= 0 || diff * diff <= r2) {
+            this->radius_range(q, r2, b, mid, depth + 1, out);
+        }
+        if (diff >= 0 || diff * diff <= r2) {
+            this->radius_range(q, r2, mid + 1, e, depth + 1, out);
+        }
+    }
+
+    void knn_range(const T q[3], std::size_t k, std::size_t b, std::size_t e, std::size_t depth,
+                   std::vector<std::pair<T, uint32_t>> &heap) const {
+        const auto offer = [&](std::size_t i) {
+            const T d2 = this->distance_squared(q, i);
+            if (heap.size() < k) {
+                heap.emplace_back(d2, this->index[i]);
+                std::push_heap(heap.begin(), heap.end());
+            } else if (d2 < heap.front().first) {
+                std::pop_heap(heap.begin(), heap.end());
+                heap.back() = { d2, this->index[i] };
+                std::push_heap(heap.begin(), heap.end());
+            }
+        };
+        const auto bound = [&] {
+            return heap.size() < k ? std::numeric_limits<T>::infinity() : heap.front().first;
+        };
+
+        if (e - b <= LeafSize) {
+            for (std::size_t i = b; i < e; ++i) {
+                offer(i);
+            }
+            return;
+        }
+
+        const std::size_t mid = (b + e) / 2;
+        const T diff = q[depth % 3] - this->coords[depth % 3][mid];
+        offer(mid);
+        if (diff <= 0) {
+            this->knn_range(q, k, b, mid, depth + 1, heap);
+            if (diff * diff <= bound()) {
+                this->knn_range(q, k, mid + 1, e, depth + 1, heap);
+            }
+        } else {
+            this->knn_range(q, k, mid + 1, e, depth + 1, heap);
+            if (diff * diff <= bound()) {
+                this->knn_range(q, k, b, mid, depth + 1, heap);
+            }
+        }
+    }
+
+    std::vector<uint32_t> index;
+    std::vector<T> coords[3];
+};
+
+} // R3::Math
@@ -1,6 +1,227 @@
 #pragma once
+#include <concepts>
+#include <cstddef>
 #include <type_traits>
+#include "types/Vec1.hpp"
+#include "types/Vec2.hpp"
+#include "types/Vec3.hpp"
+#include "types/Vec4.hpp"
 
 namespace R3::Math {
 
-} // R3::Math
\ No newline at end of file
+// Column-major, cols[c] is column c
+template<std::floating_point T>
+struct Mat3
+{
+    Vec3<T> cols[3];
+
+    Mat3() = default;
+    Mat3(const Mat3 &m) = default;
+    Mat3(Mat3 &&m) noexcept = default;
+    Mat3 &operator=(const Mat3 &m) = default;
+    Mat3(const Vec3<T> &c0, const Vec3<T> &c1, const Vec3<T> &c2)
+            : cols{ c0, c1, c2 }
+    {}
+    explicit Mat3(T s)
+            : cols{ Vec3<T>(s, 0, 0), Vec3<T>(0, s, 0), Vec3<T>(0, 0, s) }
+    {}
+
+    static Mat3 identity() {
+        return Mat3(T(1));
+    }
+
+    // Element Access
+    constexpr Vec3<T> &operator[](std::size_t c) {
+        return this->cols[c];
+    }
+    constexpr const Vec3<T> &operator[](std::size_t c) const {
+        return this->cols[c];
+    }
+    constexpr T &operator()(std::size_t r, std::size_t c) {
+        auto &v = this->cols[c];
+        return r == 0 ? v.x : r == 1 ? v.y : v.z;
+    }
+    constexpr T operator()(std::size_t r, std::size_t c) const {
+        const auto &v = this->cols[c];
+        return r == 0 ? v.x : r == 1 ? v.y : v.z;
+    }
+
+    constexpr Mat3 transpose() const {
+        const auto &[a, b, c] = this->cols;
+        return Mat3 {
+                Vec3<T>(a.x, b.x, c.x),
+                Vec3<T>(a.y, b.y, c.y),
+                Vec3<T>(a.z, b.z, c.z),
+        };
+    }
+
+    // Binary Arithmetic Operators
+    constexpr Vec3<T> operator*(const Vec3<T> &v) const {
+        const auto &[a, b, c] = this->cols;
+        return Vec3<T> {
+                a.x * v.x + b.x * v.y + c.x * v.z,
+                a.y * v.x + b.y * v.y + c.y * v.z,
+                a.z * v.x + b.z * v.y + c.z * v.z,
+        };
+    }
+    constexpr Mat3 operator*(const Mat3 &m) const {
+        return Mat3 {
+                *this * m.cols[0],
+                *this * m.cols[1],
+                *this * m.cols[2],
+        };
+    }
+
+    // Boolean Operators
+    constexpr bool operator==(const Mat3 &m) const {
+        return (
+                this->cols[0] == m.cols[0] &&
+                this->cols[1] == m.cols[1] &&
+                this->cols[2] == m.cols[2]
+        );
+    }
+};
+
+// Column-major, cols[c] is column c
+template<std::floating_point T>
+struct Mat4
+{
+    Vec4<T> cols[4];
+
+    Mat4() = default;
+    Mat4(const Mat4 &m) = default;
+    Mat4(Mat4 &&m) noexcept = default;
+    Mat4 &operator=(const Mat4 &m) = default;
+    Mat4(const Vec4<T> &c0, const Vec4<T> &c1, const Vec4<T> &c2, const Vec4<T> &c3)
+            : cols{ c0, c1, c2, c3 }
+    {}
+    explicit Mat4(T s)
+            : cols{ Vec4<T>(s, 0, 0, 0), Vec4<T>(0, s, 0, 0), Vec4<T>(0, 0, s, 0), Vec4<T>(0, 0, 0, s) }
+    {}
+
+    static Mat4 identity() {
+        return Mat4(T(1));
+    }
+
+    // Element Access
+    constexpr Vec4<T> &operator[](std::size_t c) {
+        return this->cols[c];
+    }
+    constexpr const Vec4<T> &operator[](std::size_t c) const {
+        return this->cols[c];
+    }
+    constexpr T &operator()(std::size_t r, std::size_t c) {
+        auto &v = this->cols[c];
+        return r == 0 ? v.x : r == 1 ? v.y : r == 2 ? v.z : v.w;
+    }
+    constexpr T operator()(std::size_t r, std::size_t c) const {
+        const auto &v = this->cols[c];
+        return r == 0 ? v.x : r == 1 ? v.y : r == 2 ? v.z : v.w;
+    }
+
+    constexpr Mat4 transpose() const {
+        const auto &[a, b, c, d] = this->cols;
+        return Mat4 {
+                Vec4<T>(a.x, b.x, c.x, d.x),
+                Vec4<T>(a.y, b.y, c.y, d.y),
+                Vec4<T>(a.z, b.z, c.z, d.z),
+                Vec4<T>(a.w, b.w, c.w, d.w),
+        };
+    }
+
+    // Transposed cofactor matrix from the 2x2 minors of the top and bottom row pairs
+    constexpr Mat4 adjugate() const {
+        const auto &m = *this;
+        const T s0 = m(0, 0) * m(1, 1) - m(0, 1) * m(1, 0);
+        const T s1 = m(0, 0) * m(1, 2) - m(0, 2) * m(1, 0);
+        const T s2 = m(0, 0) * m(1, 3) - m(0, 3) * m(1, 0);
+        const T s3 = m(0, 1) * m(1, 2) - m(0, 2) * m(1, 1);
+        const T s4 = m(0, 1) * m(1, 3) - m(0, 3) * m(1, 1);
+        const T s5 = m(0, 2) * m(1, 3) - m(0, 3) * m(1, 2);
+        const T c0 = m(2, 0) * m(3, 1) - m(2, 1) * m(3, 0);
+        const T c1 = m(2, 0) * m(3, 2) - m(2, 2) * m(3, 0);
+        const T c2 = m(2, 0) * m(3, 3) - m(2, 3) * m(3, 0);
+        const T c3 = m(2, 1) * m(3, 2) - m(2, 2) * m(3, 1);
+        const T c4 = m(2, 1) * m(3, 3) - m(2, 3) * m(3, 1);
+        const T c5 = m(2, 2) * m(3, 3) - m(2, 3) * m(3, 2);
+        return Mat4 {
+                Vec4<T>(
+                        m(1, 1) * c5 - m(1, 2) * c4 + m(1, 3) * c3,
+                        -m(1, 0) * c5 + m(1, 2) * c2 - m(1, 3) * c1,
+                        m(1, 0) * c4 - m(1, 1) * c2 + m(1, 3) * c0,
+                        -m(1, 0) * c3 + m(1, 1) * c1 - m(1, 2) * c0),
+                Vec4<T>(
+                        -m(0, 1) * c5 + m(0, 2) * c4 - m(0, 3) * c3,
+                        m(0, 0) * c5 - m(0, 2) * c2 + m(0, 3) * c1,
+                        -m(0, 0) * c4 + m(0, 1) * c2 - m(0, 3) * c0,
+                        m(0, 0) * c3 - m(0, 1) * c1 + m(0, 2) * c0),
+                Vec4<T>(
+                        m(3, 1) * s5 - m(3, 2) * s4 + m(3, 3) * s3,
+                        -m(3, 0) * s5 + m(3, 2) * s2 - m(3, 3) * s1,
+                        m(3, 0) * s4 - m(3, 1) * s2 + m(3, 3) * s0,
+                        -m(3, 0) * s3 + m(3, 1) * s1 - m(3, 2) * s0),
+                Vec4<T>(
+                        -m(2, 1) * s5 + m(2, 2) * s4 - m(2, 3) * s3,
+                        m(2, 0) * s5 - m(2, 2) * s2 + m(2, 3) * s1,
+                        -m(2, 0) * s4 + m(2, 1) * s2 - m(2, 3) * s0,
+                        m(2, 0) * s3 - m(2, 1) * s1 + m(2, 2) * s0),
+        };
+    }
+    // Laplace expansion along row 0, reusing a precomputed adjugate
+    constexpr T determinant(const Mat4 &adj) const {
+        return (
+                this->cols[0].x * adj.cols[0].x +
+                this->cols[1].x * adj.cols[0].y +
+                this->cols[2].x * adj.cols[0].z +
+                this->cols[3].x * adj.cols[0].w
+        );
+    }
+    constexpr T determinant() const {
+        return this->determinant(this->adjugate());
+    }
+    // Undefined for singular matrices
+    constexpr Mat4 inverse() const {
+        const Mat4 adj = this->adjugate();
+        return adj * (T(1) / this->determinant(adj));
+    }
+
+    // Binary Arithmetic Operators
+    constexpr Vec4<T> operator*(const Vec4<T> &v) const {
+        const auto &[a, b, c, d] = this->cols;
+        return Vec4<T> {
+                a.x * v.x + b.x * v.y + c.x * v.z + d.x * v.w,
+                a.y * v.x + b.y * v.y + c.y * v.z + d.y * v.w,
+                a.z * v.x + b.z * v.y + c.z * v.z + d.z * v.w,
+                a.w * v.x + b.w * v.y + c.w * v.z + d.w * v.w,
+        };
+    }
+    constexpr Mat4 operator*(const Mat4 &m) const {
+        return Mat4 {
+                *this * m.cols[0],
+                *this * m.cols[1],
+                *this * m.cols[2],
+                *this * m.cols[3],
+        };
+    }
+    constexpr Mat4 operator*(T s) const {
+        const Vec4<T> k(s);
+        return Mat4 {
+                this->cols[0] * k,
+                this->cols[1] * k,
+                this->cols[2] * k,
+                this->cols[3] * k,
+        };
+    }
+
+    // Boolean Operators
+    constexpr bool operator==(const Mat4 &m) const {
+        return (
+                this->cols[0] == m.cols[0] &&
+                this->cols[1] == m.cols[1] &&
+                this->cols[2] == m.cols[2] &&
+                this->cols[3] == m.cols[3]
+        );
+    }
+};
+
+} // R3::Math
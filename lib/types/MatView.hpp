@@ -0,0 +1,109 @@
+#pragma once
+#include <concepts>
+#include <cstddef>
+#include <type_traits>
+#include "types/VecView.hpp"
+#include "operations/parallel.hpp"
+
+namespace R3::Math {
+
+// Non-owning view of count column-major R x C matrices, stride is in scalars between consecutive matrices
+template<typename T, std::size_t R, std::size_t C>
+    requires std::floating_point<std::remove_const_t<T>> && (R >= 1 && R <= 4) && (C >= 1 && C <= 4)
+class MatView
+{
+public:
+    using scalar_type = std::remove_const_t<T>;
+
+    MatView() = default;
+    MatView(T *data, std::size_t count, std::size_t stride = R * C)
+            : ptr(data),
+              count(count),
+              step(stride)
+    {}
+    MatView(const MatView<scalar_type, R, C> &m) requires std::is_const_v<T>
+            : ptr(m.data()),
+              count(m.size()),
+              step(m.stride())
+    {}
+    MatView(const MatView &m) = default;
+    MatView &operator=(const MatView &m) = default;
+
+    // Layout
+    [[nodiscard]] constexpr T *data() const {
+        return this->ptr;
+    }
+    [[nodiscard]] constexpr std::size_t size() const {
+        return this->count;
+    }
+    [[nodiscard]] constexpr std::size_t stride() const {
+        return this->step;
+    }
+    [[nodiscard]] constexpr bool contiguous() const {
+        return this->step == R * C;
+    }
+
+    // Element Access
+    [[nodiscard]] constexpr T *operator()(std::size_t i) const {
+        return this->ptr + i * this->step;
+    }
+    [[nodiscard]] constexpr T &operator()(std::size_t i, std::size_t r, std::size_t c) const {
+        return this->ptr[i * this->step + c * R + r];
+    }
+    // Column c of every matrix, so column-wise batch operators apply across the whole array
+    [[nodiscard]] constexpr VecView<T, R> column(std::size_t c) const {
+        return VecView<T, R>(this->ptr + c * R, this->count, this->step);
+    }
+
+    // Batch Arithmetic Operators
+    template<typename U>
+    const MatView &operator+=(const MatView<U, R, C> &m) const requires (!std::is_const_v<T>) {
+        for (std::size_t c = 0; c < C; ++c) {
+            this->column(c) += m.column(c);
+        }
+        return *this;
+    }
+    template<typename U>
+    const MatView &operator-=(const MatView<U, R, C> &m) const requires (!std::is_const_v<T>) {
+        for (std::size_t c = 0; c < C; ++c) {
+            this->column(c) -= m.column(c);
+        }
+        return *this;
+    }
+    const MatView &operator*=(scalar_type s) const requires (!std::is_const_v<T>) {
+        for (std::size_t c = 0; c < C; ++c) {
+            this->column(c) *= s;
+        }
+        return *this;
+    }
+
+private:
+    T *ptr = nullptr;
+    std::size_t count = 0;
+    std::size_t step = R * C;
+};
+
+// out[i] = m[i] * v[i], a single matrix is broadcast over every vector
+template<typename T, typename U, typename V, std::size_t R, std::size_t C>
+void transform(const MatView<T, R, C> &m, const VecView<U, C> &v, const VecView<V, R> &out)
+{
+    const bool broadcast = m.size() == 1;
+    parallel_for(out.size(), [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) {
+            const T *a = m(broadcast ? 0 : i);
+            const U *b = v(i);
+            std::remove_const_t<V> result[R] = {};
+            for (std::size_t c = 0; c < C; ++c) {
+                for (std::size_t r = 0; r < R; ++r) {
+                    result[r] += a[c * R + r] * b[c];
+                }
+            }
+            V *o = out(i);
+            for (std::size_t r = 0; r < R; ++r) {
+                o[r] = result[r];
+            }
+        }
+    });
+}
+
+} // R3::Math
@@ -0,0 +1,150 @@
+#pragma once
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <vector>
+#include "types/Vec1.hpp"
+#include "types/Vec2.hpp"
+#include "types/Vec3.hpp"
+#include "operations/parallel.hpp"
+
+namespace R3::Math {
+
+// SoA particle state, Velocity may be a narrower type such as _Float16 to halve velocity traffic
+template<std::floating_point T, typename Velocity = T>
+struct Particles
+{
+    std::vector<T> px, py, pz;
+    // Previous positions, only verlet keeps them up to date
+    std::vector<T> qx, qy, qz;
+    std::vector<Velocity> vx, vy, vz;
+    std::vector<T> fx, fy, fz;
+    std::vector<T> inv_mass;
+
+    Particles() = default;
+    explicit Particles(std::size_t n) {
+        this->resize(n);
+    }
+
+    void resize(std::size_t n) {
+        for (auto *b : { &this->px, &this->py, &this->pz, &this->qx, &this->qy, &this->qz,
+                         &this->fx, &this->fy, &this->fz }) {
+            b->resize(n, T(0));
+        }
+        for (auto *b : { &this->vx, &this->vy, &this->vz }) {
+            b->resize(n, Velocity(0));
+        }
+        this->inv_mass.resize(n, T(1));
+    }
+
+    [[nodiscard]] constexpr std::size_t size() const {
+        return this->px.size();
+    }
+
+    // Element Access
+    [[nodiscard]] Vec3<T> position(std::size_t i) const {
+        return Vec3<T>(this->px[i], this->py[i], this->pz[i]);
+    }
+    [[nodiscard]] Vec3<T> velocity(std::size_t i) const {
+        return Vec3<T>(static_cast<T>(this->vx[i]), static_cast<T>(this->vy[i]), static_cast<T>(this->vz[i]));
+    }
+    // Also resets the Verlet history so the particle starts at rest
+    void set_position(std::size_t i, const Vec3<T> &p) {
+        this->px[i] = this->qx[i] = p.x;
+        this->py[i] = this->qy[i] = p.y;
+        this->pz[i] = this->qz[i] = p.z;
+    }
+    void set_velocity(std::size_t i, const Vec3<T> &v) {
+        this->vx[i] = static_cast<Velocity>(v.x);
+        this->vy[i] = static_cast<Velocity>(v.y);
+        this->vz[i] = static_cast<Velocity>(v.z);
+    }
+
+    // Rebuilds the Verlet history from the current velocity, call before switching to verlet from another integrator
+    void reset_history(T dt) {
+        parallel_for(this->size(), [&](std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; ++i) {
+                this->qx[i] = this->px[i] - static_cast<T>(this->vx[i]) * dt;
+                this->qy[i] = this->py[i] - static_cast<T>(this->vy[i]) * dt;
+                this->qz[i] = this->pz[i] - static_cast<T>(this->vz[i]) * dt;
+            }
+        });
+    }
+
+    void clear_forces() {
+        parallel_for(this->size(), [&](std::size_t begin, std::size_t end) {
+            std::fill(this->fx.begin() + begin, this->fx.begin() + end, T(0));
+            std::fill(this->fy.begin() + begin, this->fy.begin() + end, T(0));
+            std::fill(this->fz.begin() + begin, this->fz.begin() + end, T(0));
+        });
+    }
+};
+
+// v += f / m * dt, x += v * dt
+template<std::floating_point T, typename Velocity>
+void semi_implicit_euler(Particles<T, Velocity> &p, T dt)
+{
+    parallel_for(p.size(), [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) {
+            const T k = p.inv_mass[i] * dt;
+            const T vx = static_cast<T>(p.vx[i]) + p.fx[i] * k;
+            const T vy = static_cast<T>(p.vy[i]) + p.fy[i] * k;
+            const T vz = static_cast<T>(p.vz[i]) + p.fz[i] * k;
+            p.vx[i] = static_cast<Velocity>(vx);
+            p.vy[i] = static_cast<Velocity>(vy);
+            p.vz[i] = static_cast<Velocity>(vz);
+            p.px[i] += vx * dt;
+            p.py[i] += vy * dt;
+            p.pz[i] += vz * dt;
+        }
+    });
+}
+
+// Position Verlet, x' = 2x - q + f / m * dt^2 with q the previous position, velocity is derived
+template<std::floating_point T, typename Velocity>
+void verlet(Particles<T, Velocity> &p, T dt)
+{
+    const T inv_dt = T(1) / dt;
+    parallel_for(p.size(), [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) {
+            const T k = p.inv_mass[i] * dt * dt;
+            const T x = 2 * p.px[i] - p.qx[i] + p.fx[i] * k;
+            const T y = 2 * p.py[i] - p.qy[i] + p.fy[i] * k;
+            const T z = 2 * p.pz[i] - p.qz[i] + p.fz[i] * k;
+            p.vx[i] = static_cast<Velocity>((x - p.px[i]) * inv_dt);
+            p.vy[i] = static_cast<Velocity>((y - p.py[i]) * inv_dt);
+            p.vz[i] = static_cast<Velocity>((z - p.pz[i]) * inv_dt);
+            p.qx[i] = p.px[i];
+            p.qy[i] = p.py[i];
+            p.qz[i] = p.pz[i];
+            p.px[i] = x;
+            p.py[i] = y;
+            p.pz[i] = z;
+        }
+    });
+}
+
+// Midpoint RK2 against a per-particle field, accel(i, position, velocity) returns an acceleration
+template<std::floating_point T, typename Velocity, typename F>
+void rk2(Particles<T, Velocity> &p, T dt, F &&accel)
+{
+    const T h = dt / 2;
+    parallel_for(p.size(), [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) {
+            const Vec3<T> x0(p.px[i], p.py[i], p.pz[i]);
+            const Vec3<T> v0(static_cast<T>(p.vx[i]), static_cast<T>(p.vy[i]), static_cast<T>(p.vz[i]));
+            const Vec3<T> a0 = accel(i, x0, v0);
+            const Vec3<T> xm(x0.x + v0.x * h, x0.y + v0.y * h, x0.z + v0.z * h);
+            const Vec3<T> vm(v0.x + a0.x * h, v0.y + a0.y * h, v0.z + a0.z * h);
+            const Vec3<T> am = accel(i, xm, vm);
+            p.px[i] = x0.x + vm.x * dt;
+            p.py[i] = x0.y + vm.y * dt;
+            p.pz[i] = x0.z + vm.z * dt;
+            p.vx[i] = static_cast<Velocity>(v0.x + am.x * dt);
+            p.vy[i] = static_cast<Velocity>(v0.y + am.y * dt);
+            p.vz[i] = static_cast<Velocity>(v0.z + am.z * dt);
+        }
+    });
+}
+
+} // R3::Math
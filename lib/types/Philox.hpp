@@ -0,0 +1,68 @@
+#pragma once
+#include <array>
+#include <concepts>
+#include <cstdint>
+
+namespace R3::Math {
+
+// Philox4x32-10 counter-based generator, output i depends only on (seed, stream, i) so any thread
+// can produce any slice of a sequence without sharing state
+class Philox
+{
+public:
+    constexpr explicit Philox(uint64_t seed, uint64_t stream = 0)
+            : key{ static_cast<uint32_t>(seed), static_cast<uint32_t>(seed >> 32) },
+              stream_id(stream)
+    {}
+
+    [[nodiscard]] constexpr Philox stream(uint64_t id) const {
+        Philox p = *this;
+        p.stream_id = id;
+        return p;
+    }
+
+    [[nodiscard]] constexpr std::array<uint32_t, 4> operator()(uint64_t index) const {
+        uint32_t c[4] = {
+                static_cast<uint32_t>(index),
+                static_cast<uint32_t>(index >> 32),
+                static_cast<uint32_t>(this->stream_id),
+                static_cast<uint32_t>(this->stream_id >> 32),
+        };
+        uint32_t k0 = this->key[0], k1 = this->key[1];
+        for (int round = 0; round < 10; ++round) {
+            const uint64_t p0 = uint64_t(0xD2511F53) * c[0];
+            const uint64_t p1 = uint64_t(0xCD9E8D57) * c[2];
+            const uint32_t next[4] = {
+                    static_cast<uint32_t>(p1 >> 32) ^ c[1] ^ k0,
+                    static_cast<uint32_t>(p1),
+                    static_cast<uint32_t>(p0 >> 32) ^ c[3] ^ k1,
+                    static_cast<uint32_t>(p0),
+            };
+            for (int i = 0; i < 4; ++i) {
+                c[i] = next[i];
+            }
+            k0 += 0x9E3779B9;
+            k1 += 0xBB67AE85;
+        }
+        return { c[0], c[1], c[2], c[3] };
+    }
+
+    // Two uniforms in [0, 1) from output index, 24-bit for float and 53-bit for double
+    template<std::floating_point T>
+    [[nodiscard]] constexpr std::array<T, 2> uniform2(uint64_t index) const {
+        const auto r = (*this)(index);
+        if constexpr (sizeof(T) == sizeof(float)) {
+            return { static_cast<T>(r[0] >> 8) * T(0x1p-24), static_cast<T>(r[1] >> 8) * T(0x1p-24) };
+        } else {
+            const uint64_t a = (uint64_t(r[0]) << 21) ^ (r[1] >> 11);
+            const uint64_t b = (uint64_t(r[2]) << 21) ^ (r[3] >> 11);
+            return { static_cast<T>(a) * T(0x1p-53), static_cast<T>(b) * T(0x1p-53) };
+        }
+    }
+
+private:
+    uint32_t key[2];
+    uint64_t stream_id;
+};
+
+} // R3::Math
@@ -0,0 +1,14 @@
+#pragma once
+#include <concepts>
+#include <type_traits>
+
+namespace R3::Math {
+
+// Element types the Vec templates accept, specialize is_scalar to admit number-like types such as Dual
+template<typename T>
+struct is_scalar : std::bool_constant<std::floating_point<T>> {};
+
+template<typename T>
+concept Scalar = is_scalar<T>::value;
+
+} // R3::Math
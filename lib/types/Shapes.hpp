@@ -0,0 +1,93 @@
+#pragma once
+#include <concepts>
+#include <cstddef>
+#include <span>
+#include "types/Vec1.hpp"
+#include "types/Vec2.hpp"
+#include "types/Vec3.hpp"
+#include "types/Mat.hpp"
+#include "operations/dot.hpp"
+#include "operations/magnitude.hpp"
+
+namespace R3::Math {
+
+template<std::floating_point T>
+struct Sphere
+{
+    using scalar_type = T;
+
+    Vec3<T> center;
+    T radius;
+};
+
+// Oriented box, the columns of axes are its unit local axes
+template<std::floating_point T>
+struct Box
+{
+    using scalar_type = T;
+
+    Vec3<T> center;
+    Mat3<T> axes;
+    Vec3<T> half;
+};
+
+// Segment a-b swept by radius
+template<std::floating_point T>
+struct Capsule
+{
+    using scalar_type = T;
+
+    Vec3<T> a, b;
+    T radius;
+};
+
+// Convex hull given by its (non-owned) vertices
+template<std::floating_point T>
+struct Hull
+{
+    using scalar_type = T;
+
+    std::span<const Vec3<T>> points;
+};
+
+// Support Mappings, the farthest point of the shape along d
+template<std::floating_point T>
+constexpr Vec3<T> support(const Sphere<T> &s, const Vec3<T> &d)
+{
+    const T len = magnitude(d);
+    const T k = len > 0 ? s.radius / len : T(0);
+    return s.center + d * Vec3<T>(k);
+}
+
+template<std::floating_point T>
+constexpr Vec3<T> support(const Box<T> &b, const Vec3<T> &d)
+{
+    const auto &[ax, ay, az] = b.axes.cols;
+    const T sx = dot(ax, d) < 0 ? -b.half.x : b.half.x;
+    const T sy = dot(ay, d) < 0 ? -b.half.y : b.half.y;
+    const T sz = dot(az, d) < 0 ? -b.half.z : b.half.z;
+    return b.center + b.axes * Vec3<T>(sx, sy, sz);
+}
+
+template<std::floating_point T>
+constexpr Vec3<T> support(const Capsule<T> &c, const Vec3<T> &d)
+{
+    const T len = magnitude(d);
+    const T k = len > 0 ? c.radius / len : T(0);
+    return (dot(c.a, d) >= dot(c.b, d) ? c.a : c.b) + d * Vec3<T>(k);
+}
+
+template<std::floating_point T>
+constexpr Vec3<T> support(const Hull<T> &h, const Vec3<T> &d)
+{
+    std::size_t best = 0;
+    T best_dot = dot(h.points[0], d);
+    for (std::size_t i = 1; i < h.points.size(); ++i) {
+        const T p = dot(h.points[i], d);
+        best = p > best_dot ? i : best;
+        best_dot = p > best_dot ? p : best_dot;
+    }
+    return h.points[best];
+}
+
+} // R3::Math
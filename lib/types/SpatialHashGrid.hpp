@@ -0,0 +1,269 @@
+#pragma once
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <span>
+#include <utility>
+#include <vector>
+#include "types/Vec1.hpp"
+#include "types/Vec2.hpp"
+#include "types/Vec3.hpp"
+#include "operations/morton.hpp"
+#include "operations/parallel.hpp"
+#include "operations/radix_sort.hpp"
+
+namespace R3::Math {
+
+template<std::floating_point T>
+class SpatialHashGrid
+{
+public:
+    SpatialHashGrid() = default;
+    SpatialHashGrid(std::span<const Vec3<T>> points, T cell_size) {
+        this->build(points, cell_size);
+    }
+
+    // Points are radix-sorted by the Morton key of their cell and stored SoA, so every cell is a contiguous run
+    // and neighbouring cells sit close in memory. Each run is then hashed into a bucket table over the occupied
+    // cells. Every stage runs in parallel and the stable sorts keep points of a cell in input order
+    void build(std::span<const Vec3<T>> points, T cell_size) {
+        const std::size_t n = points.size();
+        this->inv_cell_size = T(1) / cell_size;
+
+        std::vector<uint64_t> keys(n);
+        this->index.resize(n);
+        parallel_for(n, [&](std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; ++i) {
+                const auto &p = points[i];
+                keys[i] = cell_key(this->cell(p.x), this->cell(p.y), this->cell(p.z));
+                this->index[i] = static_cast<uint32_t>(i);
+            }
+        });
+        radix_sort(keys, this->index);
+
+        this->xs.resize(n);
+        this->ys.resize(n);
+        this->zs.resize(n);
+        parallel_for(n, [&](std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; ++i) {
+                const auto &p = points[this->index[i]];
+                this->xs[i] = p.x;
+                this->ys[i] = p.y;
+                this->zs[i] = p.z;
+            }
+        });
+
+        // Cell runs, every block counts its run heads and then writes them at its offset
+        constexpr std::size_t block = 4096;
+        const std::size_t blocks = (n + block - 1) / block;
+        std::vector<std::size_t> offsets(blocks + 1, 0);
+        parallel_for(blocks, [&](std::size_t begin, std::size_t end) {
+            for (std::size_t b = begin; b < end; ++b) {
+                for (std::size_t i = b * block; i < std::min(n, (b + 1) * block); ++i) {
+                    offsets[b + 1] += i == 0 || keys[i] != keys[i - 1];
+                }
+            }
+        }, 1);
+        std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+
+        const std::size_t cells = offsets[blocks];
+        std::vector<uint64_t> run_key(cells);
+        std::vector<uint32_t> run_start(cells + 1);
+        parallel_for(blocks, [&](std::size_t begin, std::size_t end) {
+            for (std::size_t b = begin; b < end; ++b) {
+                std::size_t r = offsets[b];
+                for (std::size_t i = b * block; i < std::min(n, (b + 1) * block); ++i) {
+                    if (i == 0 || keys[i] != keys[i - 1]) {
+                        run_key[r] = keys[i];
+                        run_start[r++] = static_cast<uint32_t>(i);
+                    }
+                }
+            }
+        }, 1);
+        run_start[cells] = static_cast<uint32_t>(n);
+
+        std::size_t buckets = 1;
+        while (buckets < cells) {
+            buckets <<= 1;
+        }
+        this->mask = static_cast<uint32_t>(buckets - 1);
+
+        std::vector<uint32_t> bucket_keys(cells);
+        std::vector<uint32_t> order(cells);
+        parallel_for(cells, [&](std::size_t begin, std::size_t end) {
+            for (std::size_t r = begin; r < end; ++r) {
+                bucket_keys[r] = this->bucket(run_key[r]);
+                order[r] = static_cast<uint32_t>(r);
+            }
+        });
+        radix_sort(bucket_keys, order);
+
+        this->cell_keys.resize(cells);
+        this->cell_begin.resize(cells);
+        this->cell_end.resize(cells);
+        parallel_for(cells, [&](std::size_t begin, std::size_t end) {
+            for (std::size_t j = begin; j < end; ++j) {
+                this->cell_keys[j] = run_key[order[j]];
+                this->cell_begin[j] = run_start[order[j]];
+                this->cell_end[j] = run_start[order[j] + 1];
+            }
+        });
+
+        // Slot j starts every bucket in (bucket_keys[j - 1], bucket_keys[j]], so each bucket is written exactly once
+        this->bucket_start.resize(buckets + 1);
+        parallel_for(cells + 1, [&](std::size_t begin, std::size_t end) {
+            for (std::size_t j = begin; j < end; ++j) {
+                const std::size_t lo = j == 0 ? 0 : std::size_t(bucket_keys[j - 1]) + 1;
+                const std::size_t hi = j == cells ? buckets : bucket_keys[j];
+                for (std::size_t b = lo; b <= hi; ++b) {
+                    this->bucket_start[b] = static_cast<uint32_t>(j);
+                }
+            }
+        });
+    }
+
+    [[nodiscard]] constexpr std::size_t size() const {
+        return this->index.size();
+    }
+
+    // Radius Queries
+    void radius_query(const Vec3<T> &c, T radius, std::vector<uint32_t> &out) const {
+        out.clear();
+        const T r2 = radius * radius;
+        this->visit(c, radius, [&](T d2, uint32_t i) {
+            if (d2 <= r2) {
+                out.push_back(i);
+            }
+        });
+    }
+
+    void radius_query(std::span<const Vec3<T>> queries, T radius, std::vector<std::vector<uint32_t>> &out) const {
+        out.resize(queries.size());
+        parallel_for(queries.size(), [&](std::size_t begin, std::size_t end) {
+            for (std::size_t q = begin; q < end; ++q) {
+                this->radius_query(queries[q], radius, out[q]);
+            }
+        }, 64);
+    }
+
+    // K-Nearest Queries, results ordered nearest first
+    void knn_query(const Vec3<T> &c, std::size_t k, std::vector<uint32_t> &out) const {
+        out.clear();
+        k = std::min(k, this->size());
+        if (k == 0) {
+            return;
+        }
+
+        std::vector<std::pair<T, uint32_t>> found;
+        for (T radius = T(1) / this->inv_cell_size;; radius *= 2) {
+            found.clear();
+            const T r2 = radius * radius;
+            const bool everything = this->visit(c, radius, [&](T d2, uint32_t i) {
+                if (d2 <= r2) {
+                    found.emplace_back(d2, i);
+                }
+            });
+            if (found.size() >= k || everything) {
+                break;
+            }
+        }
+
+        if (found.size() < k) {
+            found.clear();
+            this->scan(0, static_cast<uint32_t>(this->size()), c, [&](T d2, uint32_t i) {
+                found.emplace_back(d2, i);
+            });
+        }
+
+        std::partial_sort(found.begin(), found.begin() + k, found.end());
+        for (std::size_t i = 0; i < k; ++i) {
+            out.push_back(found[i].second);
+        }
+    }
+
+    void knn_query(std::span<const Vec3<T>> queries, std::size_t k, std::vector<std::vector<uint32_t>> &out) const {
+        out.resize(queries.size());
+        parallel_for(queries.size(), [&](std::size_t begin, std::size_t end) {
+            for (std::size_t q = begin; q < end; ++q) {
+                this->knn_query(queries[q], k, out[q]);
+            }
+        }, 64);
+    }
+
+private:
+    // Cells wrap at 21 bits per axis, biased so that the cells around the origin stay adjacent in Morton order
+    static constexpr uint64_t cell_key(int32_t x, int32_t y, int32_t z) {
+        constexpr uint32_t bias = 1u << (morton_bits - 1);
+        return morton_encode(static_cast<uint32_t>(x) + bias, static_cast<uint32_t>(y) + bias, static_cast<uint32_t>(z) + bias);
+    }
+
+    constexpr int32_t cell(T v) const {
+        return static_cast<int32_t>(std::floor(v * this->inv_cell_size));
+    }
+
+    constexpr uint32_t bucket(uint64_t key) const {
+        return static_cast<uint32_t>((key * 0x9e3779b97f4a7c15ull) >> 32) & this->mask;
+    }
+
+    // Visits the occupied cells overlapping the query box, or every point once the box holds more cells than
+    // are occupied or wraps around the key range. Returns whether every point was visited
+    template<typename F>
+    bool visit(const Vec3<T> &c, T radius, F &&f) const {
+        if (this->index.empty()) {
+            return true;
+        }
+
+        const int64_t x0 = this->cell(c.x - radius), x1 = this->cell(c.x + radius);
+        const int64_t y0 = this->cell(c.y - radius), y1 = this->cell(c.y + radius);
+        const int64_t z0 = this->cell(c.z - radius), z1 = this->cell(c.z + radius);
+        const auto sx = static_cast<uint64_t>(x1 - x0 + 1);
+        const auto sy = static_cast<uint64_t>(y1 - y0 + 1);
+        const auto sz = static_cast<uint64_t>(z1 - z0 + 1);
+        const uint64_t limit = std::min<uint64_t>(this->cell_keys.size(), uint64_t(1) << morton_bits);
+
+        if (sx > limit || sy > limit || sz > limit || sx * sy * sz > limit) {
+            this->scan(0, static_cast<uint32_t>(this->size()), c, f);
+            return true;
+        }
+
+        for (auto z = z0; z <= z1; ++z) {
+            for (auto y = y0; y <= y1; ++y) {
+                for (auto x = x0; x <= x1; ++x) {
+                    const uint64_t key = cell_key(static_cast<int32_t>(x), static_cast<int32_t>(y), static_cast<int32_t>(z));
+                    const uint32_t b = this->bucket(key);
+                    for (uint32_t j = this->bucket_start[b], end = this->bucket_start[b + 1]; j < end; ++j) {
+                        if (this->cell_keys[j] == key) {
+                            this->scan(this->cell_begin[j], this->cell_end[j], c, f);
+                        }
+                    }
+                }
+            }
+        }
+        return false;
+    }
+
+    template<typename F>
+    void scan(uint32_t begin, uint32_t end, const Vec3<T> &c, F &&f) const {
+        const T *x = this->xs.data();
+        const T *y = this->ys.data();
+        const T *z = this->zs.data();
+        for (uint32_t i = begin; i < end; ++i) {
+            const T dx = x[i] - c.x;
+            const T dy = y[i] - c.y;
+            const T dz = z[i] - c.z;
+            f(dx * dx + dy * dy + dz * dz, this->index[i]);
+        }
+    }
+
+    T inv_cell_size = T(1);
+    uint32_t mask = 0;
+    std::vector<uint32_t> bucket_start;
+    std::vector<uint64_t> cell_keys;
+    std::vector<uint32_t> cell_begin, cell_end;
+    std::vector<uint32_t> index;
+    std::vector<T> xs, ys, zs;
+};
+
+} // R3::Math
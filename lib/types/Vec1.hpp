@@ -1,9 +1,11 @@
 #pragma once
+#include <concepts>
 #include <type_traits>
+#include "types/Scalar.hpp"
 
 namespace R3::Math {
 
-template<std::floating_point T>
+template<Scalar T>
 struct Vec1
 {
     T x;
@@ -11,10 +13,11 @@ struct Vec1
     Vec1() = default;
     Vec1(const Vec1 &v) = default;
     Vec1(Vec1 &&v) noexcept = default;
+    Vec1 &operator=(const Vec1 &v) = default;
     explicit Vec1(T x)
             : x(x)
     {};
-    template<std::floating_point U>
+    template<Scalar U>
     explicit Vec1(const Vec1<U> &v)
             : x(v.x)
     {};
@@ -30,16 +33,12 @@ struct Vec1
     }
 
     // Unary Arithmetic Operators
-    constexpr auto &operator=(const Vec1 &v) {
-        this->x = v.x;
-        return *this;
-    }
-    template<std::floating_point U>
+    template<Scalar U>
     constexpr auto &operator=(const Vec1<U> &v) {
         this->x = static_cast<T>(v.x);
         return *this;
     }
-    template<std::floating_point U>
+    template<Scalar U>
     constexpr auto &operator+=(const Vec1<U> &v) {
         this->x += static_cast<T>(v.x);
         return *this;
@@ -48,7 +47,7 @@ struct Vec1
         this->x += static_cast<T>(v);
         return *this;
     }
-    template<std::floating_point U>
+    template<Scalar U>
     constexpr auto &operator-=(const Vec1<U> &v) {
         this->x -= static_cast<T>(v.x);
         return *this;
@@ -57,7 +56,7 @@ struct Vec1
         this->x -= static_cast<T>(v);
         return *this;
     }
-    template<std::floating_point U>
+    template<Scalar U>
     constexpr auto &operator*=(const Vec1<U> &v) {
         this->x *= static_cast<T>(v.x);
         return *this;
@@ -66,7 +65,7 @@ struct Vec1
         this->x *= static_cast<T>(v);
         return *this;
     }
-    template<std::floating_point U>
+    template<Scalar U>
     constexpr auto &operator/=(const Vec1<U> &v) {
         this->x /= static_cast<T>(v.x);
         return *this;
@@ -1,9 +1,11 @@
 #pragma once
+#include <concepts>
 #include <type_traits>
+#include "types/Scalar.hpp"
 
 namespace R3::Math {
 
-template<std::floating_point T>
+template<Scalar T>
 struct Vec2
 {
     T x, y;
@@ -11,6 +13,7 @@ struct Vec2
     Vec2() = default;
     Vec2(const Vec2 &v) = default;
     Vec2(Vec2 &&v)  noexcept = default;
+    Vec2 &operator=(const Vec2 &v) = default;
     Vec2(T x, T y)
             : x(x),
               y(y)
@@ -19,7 +22,7 @@ struct Vec2
             : x(s),
               y(s)
     {};
-    template<std::floating_point U>
+    template<Scalar U>
     explicit Vec2(const Vec2<U> &v)
             : x(v.x),
               y(v.y)
@@ -46,13 +49,13 @@ struct Vec2
         this->y = v.y;
         return *this;
     }
-    template<std::floating_point U>
+    template<Scalar U>
     constexpr auto &operator=(const Vec2<U> &v) {
         this->x = static_cast<T>(v.x);
         this->y = static_cast<T>(v.y);
         return *this;
     }
-    template<std::floating_point U>
+    template<Scalar U>
     constexpr auto &operator+=(const Vec2<U> &v) {
         this->x += static_cast<T>(v.x);
         this->y += static_cast<T>(v.y);
@@ -63,7 +66,7 @@ struct Vec2
         this->y += static_cast<T>(v);
         return *this;
     }
-    template<std::floating_point U>
+    template<Scalar U>
     constexpr auto &operator-=(const Vec2<U> &v) {
         this->x -= static_cast<T>(v.x);
         this->y -= static_cast<T>(v.y);
@@ -74,7 +77,7 @@ struct Vec2
         this->y -= static_cast<T>(v);
         return *this;
     }
-    template<std::floating_point U>
+    template<Scalar U>
     constexpr auto &operator*=(const Vec2<U> &v) {
         this->x *= static_cast<T>(v.x);
         this->y *= static_cast<T>(v.y);
@@ -85,7 +88,7 @@ struct Vec2
         this->y *= static_cast<T>(v);
         return *this;
     }
-    template<std::floating_point U>
+    template<Scalar U>
     constexpr auto &operator/=(const Vec2<U> &v) {
         this->x /= static_cast<T>(v.x);
         this->y /= static_cast<T>(v.y);
@@ -1,9 +1,11 @@
 #pragma once
+#include <concepts>
 #include <type_traits>
+#include "types/Scalar.hpp"
 
 namespace R3::Math {
 
-template<std::floating_point T>
+template<Scalar T>
 struct Vec3
 {
     T x, y, z;
@@ -11,6 +13,7 @@ struct Vec3
     Vec3() = default;
     Vec3(const Vec3 &v) = default;
     Vec3(Vec3 &&v)  noexcept = default;
+    Vec3 &operator=(const Vec3 &v) = default;
     Vec3(T x, T y, T z)
             : x(x),
               y(y),
@@ -21,7 +24,7 @@ struct Vec3
               y(s),
               z(s)
     {};
-    template<std::floating_point U>
+    template<Scalar U>
     explicit Vec3(const Vec3<U> &v)
             : x(v.x),
               y(v.y),
@@ -57,14 +60,14 @@ struct Vec3
         this->z = v.z;
         return *this;
     }
-    template<std::floating_point U>
+    template<Scalar U>
     constexpr auto &operator=(const Vec3<U> &v) {
         this->x = static_cast<T>(v.x);
         this->y = static_cast<T>(v.y);
         this->z = static_cast<T>(v.z);
         return *this;
     }
-    template<std::floating_point U>
+    template<Scalar U>
     constexpr auto &operator+=(const Vec3<U> &v) {
         this->x += static_cast<T>(v.x);
         this->y += static_cast<T>(v.y);
@@ -77,7 +80,7 @@ struct Vec3
         this->z += static_cast<T>(v);
         return *this;
     }
-    template<std::floating_point U>
+    template<Scalar U>
     constexpr auto &operator-=(const Vec3<U> &v) {
         this->x -= static_cast<T>(v.x);
         this->y -= static_cast<T>(v.y);
@@ -90,7 +93,7 @@ struct Vec3
         this->z -= static_cast<T>(v);
         return *this;
     }
-    template<std::floating_point U>
+    template<Scalar U>
     constexpr auto &operator*=(const Vec3<U> &v) {
         this->x *= static_cast<T>(v.x);
         this->y *= static_cast<T>(v.y);
@@ -103,7 +106,7 @@ struct Vec3
         this->z *= static_cast<T>(v);
         return *this;
     }
-    template<std::floating_point U>
+    template<Scalar U>
     constexpr auto &operator/=(const Vec3<U> &v) {
         this->x /= static_cast<T>(v.x);
         this->y /= static_cast<T>(v.y);
@@ -1,9 +1,11 @@
 #pragma once
+#include <concepts>
 #include <type_traits>
+#include "types/Scalar.hpp"
 
 namespace R3::Math {
 
-template<std::floating_point T>
+template<Scalar T>
 struct Vec4
 {
     T x, y, z, w;
@@ -11,6 +13,7 @@ struct Vec4
     Vec4() = default;
     Vec4(const Vec4 &v) = default;
     Vec4(Vec4 &&v) noexcept = default;
+    Vec4 &operator=(const Vec4 &v) = default;
     Vec4(T x, T y, T z, T w)
             : x(x),
               y(y),
@@ -23,7 +26,7 @@ struct Vec4
               z(s),
               w(s)
     {};
-    template<std::floating_point U>
+    template<Scalar U>
     explicit Vec4(const Vec4<U> &v)
             : x(v.x),
               y(v.y),
@@ -69,7 +72,7 @@ struct Vec4
         this->w = v.w;
         return *this;
     }
-    template<std::floating_point U>
+    template<Scalar U>
     constexpr auto &operator=(const auto &v) {
         this->x = static_cast<T>(v.x);
         this->y = static_cast<T>(v.y);
@@ -77,7 +80,7 @@ struct Vec4
         this->w = static_cast<T>(v.w);
         return *this;
     }
-    template<std::floating_point U>
+    template<Scalar U>
     constexpr auto &operator+=(const Vec4<U> &v) {
         this->x += static_cast<T>(v.x);
         this->y += static_cast<T>(v.y);
@@ -92,7 +95,7 @@ struct Vec4
         this->w += static_cast<T>(v);
         return *this;
     }
-    template<std::floating_point U>
+    template<Scalar U>
     constexpr auto &operator-=(const Vec4<U> &v) {
         this->x -= static_cast<T>(v.x);
         this->y -= static_cast<T>(v.y);
@@ -107,7 +110,7 @@ struct Vec4
         this->w -= static_cast<T>(v);
         return *this;
     }
-    template<std::floating_point U>
+    template<Scalar U>
     constexpr auto &operator*=(const Vec4<U> &v) {
         this->x *= static_cast<T>(v.x);
         this->y *= static_cast<T>(v.y);
@@ -122,7 +125,7 @@ struct Vec4
         this->w *= static_cast<T>(v);
         return *this;
     }
-    template<std::floating_point U>
+    template<Scalar U>
     constexpr auto &operator/=(const Vec4<U> &v) {
         this->x /= static_cast<T>(v.x);
         this->y /= static_cast<T>(v.y);
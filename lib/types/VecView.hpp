@@ -0,0 +1,282 @@
+#pragma once
+#include <bit>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+#include "types/Vec1.hpp"
+#include "types/Vec2.hpp"
+#include "types/Vec3.hpp"
+#include "types/Vec4.hpp"
+#include "operations/parallel.hpp"
+
+namespace R3::Math {
+
+template<std::floating_point T, std::size_t N>
+struct VecOf;
+template<std::floating_point T>
+struct VecOf<T, 1> { using type = Vec1<T>; };
+template<std::floating_point T>
+struct VecOf<T, 2> { using type = Vec2<T>; };
+template<std::floating_point T>
+struct VecOf<T, 3> { using type = Vec3<T>; };
+template<std::floating_point T>
+struct VecOf<T, 4> { using type = Vec4<T>; };
+
+template<std::floating_point T, std::size_t N>
+using VecOf_t = typename VecOf<T, N>::type;
+
+// A Vec array can be viewed as raw scalars only if it is exactly N tightly packed T
+template<typename V, typename T, std::size_t N>
+concept PackedVec = std::is_trivially_copyable_v<V> &&
+                    std::is_standard_layout_v<V> &&
+                    sizeof(V) == N * sizeof(T) &&
+                    alignof(V) == alignof(T);
+
+static_assert(PackedVec<Vec1<float>, float, 1> && PackedVec<Vec1<double>, double, 1>);
+static_assert(PackedVec<Vec2<float>, float, 2> && PackedVec<Vec2<double>, double, 2>);
+static_assert(PackedVec<Vec3<float>, float, 3> && PackedVec<Vec3<double>, double, 3>);
+static_assert(PackedVec<Vec4<float>, float, 4> && PackedVec<Vec4<double>, double, 4>);
+
+// Component Access
+template<typename V>
+constexpr auto component(const V &v, std::size_t j)
+{
+    if constexpr (requires { v.w; }) {
+        return j == 0 ? v.x : j == 1 ? v.y : j == 2 ? v.z : v.w;
+    } else if constexpr (requires { v.z; }) {
+        return j == 0 ? v.x : j == 1 ? v.y : v.z;
+    } else if constexpr (requires { v.y; }) {
+        return j == 0 ? v.x : v.y;
+    } else {
+        return v.x;
+    }
+}
+
+template<std::floating_point T, std::size_t N>
+constexpr VecOf_t<T, N> load_vec(const T *p)
+{
+    if constexpr (N == 1) {
+        return VecOf_t<T, N>(p[0]);
+    } else if constexpr (N == 2) {
+        return VecOf_t<T, N>(p[0], p[1]);
+    } else if constexpr (N == 3) {
+        return VecOf_t<T, N>(p[0], p[1], p[2]);
+    } else {
+        return VecOf_t<T, N>(p[0], p[1], p[2], p[3]);
+    }
+}
+
+template<typename V, std::floating_point T>
+constexpr void store_vec(const V &v, T *p)
+{
+    p[0] = v.x;
+    if constexpr (requires { v.y; }) {
+        p[1] = v.y;
+    }
+    if constexpr (requires { v.z; }) {
+        p[2] = v.z;
+    }
+    if constexpr (requires { v.w; }) {
+        p[3] = v.w;
+    }
+}
+
+// Non-owning view of count N-component vectors, stride is in scalars between consecutive vectors
+template<typename T, std::size_t N>
+    requires std::floating_point<std::remove_const_t<T>> && (N >= 1 && N <= 4)
+class VecView
+{
+public:
+    using scalar_type = std::remove_const_t<T>;
+    using value_type = VecOf_t<scalar_type, N>;
+
+    VecView() = default;
+    VecView(T *data, std::size_t count, std::size_t stride = N)
+            : ptr(data),
+              count(count),
+              step(stride)
+    {}
+    template<typename V>
+        requires PackedVec<std::remove_const_t<V>, scalar_type, N> && (std::is_const_v<T> || !std::is_const_v<V>)
+    VecView(std::span<V> v)
+            : ptr(v.empty() ? nullptr : &v.data()->x),
+              count(v.size()),
+              step(N)
+    {}
+    VecView(const VecView<scalar_type, N> &v) requires std::is_const_v<T>
+            : ptr(v.data()),
+              count(v.size()),
+              step(v.stride())
+    {}
+    VecView(const VecView &v) = default;
+    VecView &operator=(const VecView &v) = default;
+
+    // Layout
+    [[nodiscard]] constexpr T *data() const {
+        return this->ptr;
+    }
+    [[nodiscard]] constexpr std::size_t size() const {
+        return this->count;
+    }
+    [[nodiscard]] constexpr bool empty() const {
+        return this->count == 0;
+    }
+    [[nodiscard]] constexpr std::size_t stride() const {
+        return this->step;
+    }
+    [[nodiscard]] constexpr bool contiguous() const {
+        return this->step == N;
+    }
+    [[nodiscard]] std::size_t alignment() const {
+        const auto address = reinterpret_cast<std::uintptr_t>(this->ptr);
+        return address == 0 ? alignof(std::max_align_t) : std::size_t(1) << std::countr_zero(address);
+    }
+    [[nodiscard]] constexpr VecView subview(std::size_t offset, std::size_t n) const {
+        return VecView(this->ptr + offset * this->step, n, this->step);
+    }
+
+    // Element Access
+    [[nodiscard]] constexpr T *operator()(std::size_t i) const {
+        return this->ptr + i * this->step;
+    }
+    [[nodiscard]] constexpr value_type operator[](std::size_t i) const {
+        return load_vec<scalar_type, N>((*this)(i));
+    }
+    constexpr void store(std::size_t i, const value_type &v) const requires (!std::is_const_v<T>) {
+        store_vec(v, (*this)(i));
+    }
+
+    // Batch Arithmetic Operators
+    template<typename U>
+    const VecView &assign(const VecView<U, N> &v) const requires (!std::is_const_v<T>) {
+        return this->apply(v, [](T &a, auto b) { a = static_cast<T>(b); });
+    }
+    template<typename U>
+    const VecView &operator+=(const VecView<U, N> &v) const requires (!std::is_const_v<T>) {
+        return this->apply(v, [](T &a, auto b) { a += static_cast<T>(b); });
+    }
+    const VecView &operator+=(const value_type &v) const requires (!std::is_const_v<T>) {
+        return this->apply(v, [](T &a, T b) { a += b; });
+    }
+    const VecView &operator+=(scalar_type s) const requires (!std::is_const_v<T>) {
+        return this->apply(s, [](T &a, T b) { a += b; });
+    }
+    template<typename U>
+    const VecView &operator-=(const VecView<U, N> &v) const requires (!std::is_const_v<T>) {
+        return this->apply(v, [](T &a, auto b) { a -= static_cast<T>(b); });
+    }
+    const VecView &operator-=(const value_type &v) const requires (!std::is_const_v<T>) {
+        return this->apply(v, [](T &a, T b) { a -= b; });
+    }
+    const VecView &operator-=(scalar_type s) const requires (!std::is_const_v<T>) {
+        return this->apply(s, [](T &a, T b) { a -= b; });
+    }
+    template<typename U>
+    const VecView &operator*=(const VecView<U, N> &v) const requires (!std::is_const_v<T>) {
+        return this->apply(v, [](T &a, auto b) { a *= static_cast<T>(b); });
+    }
+    const VecView &operator*=(const value_type &v) const requires (!std::is_const_v<T>) {
+        return this->apply(v, [](T &a, T b) { a *= b; });
+    }
+    const VecView &operator*=(scalar_type s) const requires (!std::is_const_v<T>) {
+        return this->apply(s, [](T &a, T b) { a *= b; });
+    }
+    template<typename U>
+    const VecView &operator/=(const VecView<U, N> &v) const requires (!std::is_const_v<T>) {
+        return this->apply(v, [](T &a, auto b) { a /= static_cast<T>(b); });
+    }
+    const VecView &operator/=(const value_type &v) const requires (!std::is_const_v<T>) {
+        return this->apply(v, [](T &a, T b) { a /= b; });
+    }
+    const VecView &operator/=(scalar_type s) const requires (!std::is_const_v<T>) {
+        return this->apply(s, [](T &a, T b) { a /= b; });
+    }
+
+private:
+    template<typename U, typename F>
+    const VecView &apply(const VecView<U, N> &v, F &&f) const {
+        parallel_for(this->count, [&](std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; ++i) {
+                T *a = (*this)(i);
+                const U *b = v(i);
+                for (std::size_t j = 0; j < N; ++j) {
+                    f(a[j], b[j]);
+                }
+            }
+        });
+        return *this;
+    }
+    template<typename F>
+    const VecView &apply(const value_type &v, F &&f) const {
+        scalar_type c[N];
+        for (std::size_t j = 0; j < N; ++j) {
+            c[j] = component(v, j);
+        }
+        parallel_for(this->count, [&](std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; ++i) {
+                T *a = (*this)(i);
+                for (std::size_t j = 0; j < N; ++j) {
+                    f(a[j], c[j]);
+                }
+            }
+        });
+        return *this;
+    }
+    template<typename F>
+    const VecView &apply(scalar_type s, F &&f) const {
+        parallel_for(this->count, [&](std::size_t begin, std::size_t end) {
+            for (std::size_t i = begin; i < end; ++i) {
+                T *a = (*this)(i);
+                for (std::size_t j = 0; j < N; ++j) {
+                    f(a[j], s);
+                }
+            }
+        });
+        return *this;
+    }
+
+    T *ptr = nullptr;
+    std::size_t count = 0;
+    std::size_t step = N;
+};
+
+template<typename V>
+VecView(std::span<V>) -> VecView<std::conditional_t<std::is_const_v<V>, const decltype(V::x), decltype(V::x)>,
+                                 sizeof(V) / sizeof(decltype(V::x))>;
+
+// Batch Operations
+template<typename T, typename U, std::size_t N>
+void dot(const VecView<T, N> &v1, const VecView<U, N> &v2, std::span<std::remove_const_t<T>> out)
+{
+    parallel_for(out.size(), [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) {
+            const T *a = v1(i);
+            const U *b = v2(i);
+            std::remove_const_t<T> sum = 0;
+            for (std::size_t j = 0; j < N; ++j) {
+                sum += a[j] * b[j];
+            }
+            out[i] = sum;
+        }
+    });
+}
+
+template<typename T, std::size_t N>
+void magnitude(const VecView<T, N> &v, std::span<std::remove_const_t<T>> out)
+{
+    parallel_for(out.size(), [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) {
+            const T *a = v(i);
+            std::remove_const_t<T> sum = 0;
+            for (std::size_t j = 0; j < N; ++j) {
+                sum += a[j] * a[j];
+            }
+            out[i] = std::sqrt(sum);
+        }
+    });
+}
+
+} // R3::Math
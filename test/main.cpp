@@ -1,12 +1,40 @@
+// The suites report through assert, keep it live in every build type
+#undef NDEBUG
 #include <immintrin.h>
 #include <iostream>
 #include <cassert>
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <vector>
 #include "types/Vec1.hpp"
 #include "types/Vec2.hpp"
 #include "types/Vec3.hpp"
 #include "types/Vec4.hpp"
 #include "operations/dot.hpp"
 #include "operations/magnitude.hpp"
+#include "operations/distance.hpp"
+#include "types/SpatialHashGrid.hpp"
+#include "types/KdTree.hpp"
+#include "operations/morton.hpp"
+#include "operations/spatial_sort.hpp"
+#include "types/VecView.hpp"
+#include "types/MatView.hpp"
+#include "types/Curve.hpp"
+#include "types/Particles.hpp"
+#include "types/Mat.hpp"
+#include "operations/eigen.hpp"
+#include "operations/covariance.hpp"
+#include "types/Shapes.hpp"
+#include "operations/gjk.hpp"
+#include "operations/sat.hpp"
+#include "types/Philox.hpp"
+#include "operations/sampling.hpp"
+#include "types/Dual.hpp"
+#include "operations/cross.hpp"
+#include "types/CachedMat4.hpp"
+#include "operations/mesh.hpp"
 
 using namespace R3::Math;
 
@@ -14,6 +42,17 @@ void test_vec1();
 void test_vec2();
 void test_vec3();
 void test_vec4();
+void test_spatial();
+void test_spatial_sort();
+void test_views();
+void test_curves();
+void test_particles();
+void test_eigen();
+void test_collision();
+void test_sampling();
+void test_dual();
+void test_cached_mat();
+void test_mesh();
 
 int main()
 {
@@ -23,12 +62,23 @@ int main()
     Vec1 vec1(2.0f);
     std::cout << magnitude(vec1) << '\n';
 
-    return 0;
-
     test_vec1();
     test_vec2();
     test_vec3();
     test_vec4();
+    test_spatial();
+    test_spatial_sort();
+    test_views();
+    test_curves();
+    test_particles();
+    test_eigen();
+    test_collision();
+    test_sampling();
+    test_dual();
+    test_cached_mat();
+    test_mesh();
+
+    return 0;
 }
 
 void test_vec1()
@@ -64,3 +114,593 @@ void test_vec4()
     Vec4 d = { Vec1(1.0), 1.0, 1.0, 1.0 };
     assert(a == b && b == c && c == d);
 }
+
+void test_spatial()
+{
+    std::mt19937 rng(26);
+    std::uniform_real_distribution<float> dist(-10.0f, 10.0f);
+    std::vector<Vec3<float>> points, queries;
+    for (int i = 0; i < 5000; ++i) {
+        points.emplace_back(dist(rng), dist(rng), dist(rng));
+    }
+    for (int i = 0; i < 64; ++i) {
+        queries.emplace_back(dist(rng), dist(rng), dist(rng));
+    }
+
+    SpatialHashGrid<float> grid(points, 1.0f);
+    KdTree<float> tree(points);
+
+    std::vector<std::vector<uint32_t>> grid_radius, tree_radius, grid_knn, tree_knn;
+    grid.radius_query(queries, 2.0f, grid_radius);
+    tree.radius_query(queries, 2.0f, tree_radius);
+    grid.knn_query(queries, 8, grid_knn);
+    tree.knn_query(queries, 8, tree_knn);
+
+    for (std::size_t q = 0; q < queries.size(); ++q) {
+        std::vector<uint32_t> expected;
+        for (uint32_t i = 0; i < points.size(); ++i) {
+            if (distance_squared(points[i], queries[q]) <= 4.0f) {
+                expected.push_back(i);
+            }
+        }
+        std::sort(grid_radius[q].begin(), grid_radius[q].end());
+        std::sort(tree_radius[q].begin(), tree_radius[q].end());
+        assert(grid_radius[q] == expected && tree_radius[q] == expected);
+
+        std::vector<uint32_t> order(points.size());
+        std::iota(order.begin(), order.end(), 0u);
+        std::partial_sort(order.begin(), order.begin() + 8, order.end(), [&](uint32_t i, uint32_t j) {
+            return distance_squared(points[i], queries[q]) < distance_squared(points[j], queries[q]);
+        });
+        order.resize(8);
+        assert(grid_knn[q] == order && tree_knn[q] == order);
+    }
+
+    // A box wider than the occupied cells scans everything, so does a query far outside the points
+    std::vector<uint32_t> all, far;
+    grid.radius_query(Vec3(0.0f, 0.0f, 0.0f), 100.0f, all);
+    assert(all.size() == points.size());
+    grid.knn_query(Vec3(1e4f, 0.0f, 0.0f), 3, far);
+    tree.knn_query(Vec3(1e4f, 0.0f, 0.0f), 3, all);
+    assert(far == all);
+}
+
+void test_spatial_sort()
+{
+    assert(morton_encode(1, 0, 0) == 1 && morton_encode(0, 1, 0) == 2 && morton_encode(0, 0, 1) == 4);
+    for (uint64_t h = 0; h < 4096; ++h) {
+        const auto a = hilbert_decode(h);
+        const auto b = hilbert_decode(h + 1);
+        assert(hilbert_encode(a[0], a[1], a[2]) == h);
+        assert(morton_decode(morton_encode(a[0], a[1], a[2])) == a);
+        uint32_t steps = 0;
+        for (int i = 0; i < 3; ++i) {
+            steps += a[i] > b[i] ? a[i] - b[i] : b[i] - a[i];
+        }
+        assert(steps == 1);
+    }
+
+    std::mt19937 rng(27);
+    std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+    std::vector<Vec4<float>> points;
+    std::vector<uint32_t> ids;
+    for (uint32_t i = 0; i < 200000; ++i) {
+        points.emplace_back(dist(rng), dist(rng), dist(rng), static_cast<float>(i));
+        ids.push_back(i);
+    }
+
+    const auto order = spatial_sort(points, SpaceFillingCurve::Hilbert, ids);
+    std::vector<uint64_t> keys(points.size());
+    spatial_keys(points, keys, SpaceFillingCurve::Hilbert);
+    assert(std::is_sorted(keys.begin(), keys.end()));
+    for (std::size_t i = 0; i < points.size(); ++i) {
+        assert(ids[i] == order[i] && points[i].w == static_cast<float>(ids[i]));
+    }
+
+    // 32-bit keys sort stably, equal keys keep their input order
+    std::vector<uint32_t> narrow(200000), slots(narrow.size());
+    for (std::size_t i = 0; i < narrow.size(); ++i) {
+        narrow[i] = static_cast<uint32_t>(rng()) % 5000 + (i % 3 == 0 ? 0xff000000u : 0u);
+        slots[i] = static_cast<uint32_t>(i);
+    }
+    const auto unsorted = narrow;
+    radix_sort(narrow, slots);
+    assert(std::is_sorted(narrow.begin(), narrow.end()));
+    for (std::size_t i = 0; i < narrow.size(); ++i) {
+        assert(unsorted[slots[i]] == narrow[i] && (i == 0 || narrow[i - 1] != narrow[i] || slots[i - 1] < slots[i]));
+    }
+}
+
+void test_views()
+{
+    // Interleaved position + uv staging layout
+    std::vector<float> buffer(5 * 100);
+    for (std::size_t i = 0; i < buffer.size(); ++i) {
+        buffer[i] = static_cast<float>(i);
+    }
+    VecView<float, 3> positions(buffer.data(), 100, 5);
+    VecView<const float, 2> uvs(buffer.data() + 3, 100, 5);
+    assert(positions[1] == Vec3(5.0f, 6.0f, 7.0f) && uvs[1] == Vec2(8.0f, 9.0f));
+
+    positions *= 2.0f;
+    positions += Vec3(1.0f, 0.0f, 0.0f);
+    assert(positions[1] == Vec3(11.0f, 12.0f, 14.0f) && buffer[3] == 3.0f);
+
+    std::vector<Vec3<float>> packed(100, Vec3(1.0f));
+    VecView packed_view = std::span(packed);
+    packed_view.assign(positions);
+    assert(packed[1] == Vec3(11.0f, 12.0f, 14.0f));
+    positions.store(2, Vec3(0.0f, 3.0f, 4.0f));
+
+    std::vector<float> lengths(100);
+    magnitude(positions, std::span(lengths));
+    assert(lengths[2] == 5.0f);
+
+    float matrix[16] = {};
+    for (int d = 0; d < 4; ++d) {
+        matrix[d * 4 + d] = 2.0f;
+    }
+    MatView<const float, 4, 4> scale(matrix, 1);
+    std::vector<Vec4<float>> in(8, Vec4(1.0f, 2.0f, 3.0f, 1.0f)), out(8);
+    transform(scale, VecView<const float, 4>(std::span<const Vec4<float>>(in)), VecView<float, 4>(std::span(out)));
+    assert(out[7] == Vec4(2.0f, 4.0f, 6.0f, 2.0f));
+}
+
+void test_curves()
+{
+    const auto line = Cubic<float, 3>::bezier(Vec3(0.0f), Vec3(1.0f, 0.0f, 0.0f), Vec3(2.0f, 0.0f, 0.0f), Vec3(3.0f, 0.0f, 0.0f));
+    assert(line.position(0.5f) == Vec3(1.5f, 0.0f, 0.0f) && line.tangent(0.25f) == Vec3(3.0f, 0.0f, 0.0f));
+
+    std::vector<Vec3<float>> flat;
+    line.flatten(0.01f, flat);
+    assert(flat.size() == 2 && flat.back() == Vec3(3.0f, 0.0f, 0.0f));
+
+    ArcLengthTable<float> table(line, 32);
+    assert(std::abs(table.length() - 3.0f) < 1e-5f && std::abs(table.parameter(1.5f) - 0.5f) < 1e-5f);
+    assert(ArcLengthTable<float>().parameter(1.0f) == 0.0f && ArcLengthTable<float>(line, 1).parameter(3.0f) == 1.0f);
+    bool rejected = false;
+    try {
+        ArcLengthTable<float> empty(line, 0);
+    } catch (const std::invalid_argument &) {
+        rejected = true;
+    }
+    assert(rejected);
+
+    const auto rail = Cubic<float, 2>::catmull_rom(Vec2(0.0f, 0.0f), Vec2(1.0f, 1.0f), Vec2(2.0f, 0.0f), Vec2(3.0f, 1.0f));
+    assert(rail.position(0.0f) == Vec2(1.0f, 1.0f) && rail.position(1.0f) == Vec2(2.0f, 0.0f));
+
+    const auto ease = Cubic<float, 2>::hermite(Vec2(0.0f, 0.0f), Vec2(1.0f, 0.0f), Vec2(1.0f, 1.0f), Vec2(0.0f, 1.0f));
+    assert(ease.tangent(0.0f) == Vec2(1.0f, 0.0f) && ease.tangent(1.0f) == Vec2(0.0f, 1.0f));
+
+    std::vector<float> ts(1000);
+    for (std::size_t i = 0; i < ts.size(); ++i) {
+        ts[i] = static_cast<float>(i) / 999.0f;
+    }
+    std::vector<Vec2<float>> points(ts.size());
+    rail.positions(ts, VecView<float, 2>(std::span(points)));
+    for (std::size_t i = 0; i < ts.size(); ++i) {
+        assert(points[i] == rail.position(ts[i]));
+    }
+
+    std::vector<Vec2<float>> polyline;
+    rail.flatten(0.001f, polyline);
+    assert(polyline.size() > 2 && polyline.front() == rail.position(0.0f) && polyline.back() == rail.position(1.0f));
+
+    const std::vector<Cubic<float, 2>> curves = { rail, ease };
+    const float half[] = { 0.5f };
+    std::vector<Vec2<float>> mids(2);
+    Cubic<float, 2>::positions(curves, half, VecView<float, 2>(std::span(mids)));
+    assert(mids[0] == rail.position(0.5f) && mids[1] == ease.position(0.5f));
+}
+
+void test_particles()
+{
+    Particles<double> euler(1000), stormer(1000), midpoint(1000);
+    for (std::size_t i = 0; i < 1000; ++i) {
+        for (auto *p : { &euler, &stormer, &midpoint }) {
+            p->set_position(i, Vec3(static_cast<double>(i), 0.0, 0.0));
+            p->inv_mass[i] = 0.5;
+        }
+        euler.set_velocity(i, Vec3(0.0, 1.0, 0.0));
+        midpoint.set_velocity(i, Vec3(0.0, 1.0, 0.0));
+    }
+
+    // Constant force -2 on z with inverse mass 0.5 is a unit downward acceleration
+    const double dt = 0.01;
+    for (int step = 0; step < 100; ++step) {
+        for (auto *p : { &euler, &stormer }) {
+            p->clear_forces();
+            std::fill(p->fz.begin(), p->fz.end(), -2.0);
+        }
+        semi_implicit_euler(euler, dt);
+        verlet(stormer, dt);
+        rk2(midpoint, dt, [](std::size_t, const Vec3<double> &, const Vec3<double> &) {
+            return Vec3(0.0, 0.0, -1.0);
+        });
+    }
+
+    // After t = 1, z = -t^2 / 2 exactly for midpoint, to O(dt) for the others
+    for (std::size_t i = 0; i < 1000; i += 111) {
+        assert(std::abs(midpoint.pz[i] + 0.5) < 1e-9 && std::abs(midpoint.py[i] - 1.0) < 1e-9);
+        assert(std::abs(euler.pz[i] + 0.5) < dt && std::abs(euler.velocity(i).z + 1.0) < 1e-9);
+        assert(std::abs(stormer.pz[i] + 0.5) < dt && stormer.px[i] == static_cast<double>(i));
+    }
+
+    // Only verlet keeps the history, switching to it rebuilds the history from the velocity first
+    assert(euler.qy[5] == 0.0 && midpoint.qy[5] == 0.0);
+    const double y = euler.py[5];
+    euler.reset_history(dt);
+    verlet(euler, dt);
+    assert(std::abs(euler.py[5] - (y + dt)) < 1e-12 && std::abs(euler.velocity(5).y - 1.0) < 1e-9);
+
+#ifdef __FLT16_MAX__
+    Particles<float, _Float16> half(16);
+    half.set_velocity(3, Vec3(1.0f, 2.0f, 4.0f));
+    semi_implicit_euler(half, 0.5f);
+    assert(half.position(3) == Vec3(0.5f, 1.0f, 2.0f));
+#endif
+}
+
+void test_eigen()
+{
+    const auto near = [](const Mat3<double> &a, const Mat3<double> &b) {
+        for (std::size_t r = 0; r < 3; ++r) {
+            for (std::size_t c = 0; c < 3; ++c) {
+                if (std::abs(a(r, c) - b(r, c)) > 1e-9) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    };
+
+    std::mt19937 rng(31);
+    std::uniform_real_distribution<double> dist(-1.0, 1.0);
+    std::vector<Mat3<double>> general, symmetric;
+    for (int i = 0; i < 37; ++i) {
+        Mat3<double> m;
+        for (std::size_t r = 0; r < 3; ++r) {
+            for (std::size_t c = 0; c < 3; ++c) {
+                m(r, c) = dist(rng);
+            }
+        }
+        general.push_back(m);
+        symmetric.push_back(m.transpose() * m);
+    }
+    general.emplace_back(Vec3(1.0, 2.0, 3.0), Vec3(2.0, 4.0, 6.0), Vec3(0.0));
+    general.emplace_back(0.0);
+
+    std::vector<SymmetricEigen3<double>> eig(symmetric.size());
+    eig3<double>(symmetric, eig);
+    for (std::size_t i = 0; i < symmetric.size(); ++i) {
+        const auto &[w, v] = eig[i];
+        const Mat3<double> diag(Vec3(w.x, 0.0, 0.0), Vec3(0.0, w.y, 0.0), Vec3(0.0, 0.0, w.z));
+        assert(w.x >= w.y && w.y >= w.z);
+        assert(near(v * diag * v.transpose(), symmetric[i]) && near(v.transpose() * v, Mat3<double>::identity()));
+    }
+
+    std::vector<Svd3<double>> svd(general.size());
+    svd3<double>(general, svd);
+    for (std::size_t i = 0; i < general.size(); ++i) {
+        const auto &[u, s, v] = svd[i];
+        const Mat3<double> diag(Vec3(s.x, 0.0, 0.0), Vec3(0.0, s.y, 0.0), Vec3(0.0, 0.0, s.z));
+        assert(near(u * diag * v.transpose(), general[i]) && near(u.transpose() * u, Mat3<double>::identity()));
+    }
+
+    const auto single = eig3(Mat3(Vec3(2.0f, 0.0f, 0.0f), Vec3(0.0f, 5.0f, 0.0f), Vec3(0.0f, 0.0f, 3.0f)));
+    assert(single.values == Vec3(5.0f, 3.0f, 2.0f));
+
+    std::vector<Vec3<float>> line;
+    for (int i = 0; i < 1000; ++i) {
+        line.emplace_back(100.0f + i * 0.01f, 100.0f + i * 0.02f, 100.0f);
+    }
+    const auto axis = eig3(covariance<float>(line)).vectors[0];
+    assert(std::abs(std::abs(axis.x) - 1.0f / std::sqrt(5.0f)) < 1e-4f && std::abs(axis.z) < 1e-4f);
+
+    // Block partials combine in block order whatever the schedule
+    const auto order = parallel_reduce(20000, std::vector<std::size_t> {}, [](std::size_t begin, std::size_t) {
+        return std::vector<std::size_t> { begin };
+    }, [](std::vector<std::size_t> a, const std::vector<std::size_t> &b) {
+        a.insert(a.end(), b.begin(), b.end());
+        return a;
+    }, 1000);
+    assert(order.size() == 20 && std::is_sorted(order.begin(), order.end()));
+}
+
+void test_collision()
+{
+    const auto close = [](double a, double b) { return std::abs(a - b) < 1e-6; };
+
+    const Sphere<double> s1 { Vec3(0.0), 1.0 };
+    const Sphere<double> s2 { Vec3(3.0, 0.0, 0.0), 1.0 };
+    const auto apart = gjk_distance(s1, s2);
+    assert(!apart.intersecting && close(apart.distance, 1.0) && close(apart.point_a.x, 1.0) && close(apart.point_b.x, 2.0));
+
+    const Sphere<double> s3 { Vec3(1.5, 0.0, 0.0), 1.0 };
+    const auto overlap = epa(s1, s3);
+    assert(overlap.intersecting && std::abs(overlap.depth - 0.5) < 1e-3 && overlap.normal.x > 0.999);
+
+    // Curved shapes exhaust the budget, the depth is then flagged as a lower bound
+    const auto same = epa(s1, s1);
+    const auto same_long = epa(s1, s1, 512);
+    assert(same.intersecting && !same.converged && same.depth <= 2.0 && same.depth > 1.8);
+    assert(same_long.depth >= same.depth && same_long.depth <= 2.0);
+
+    // Stopping early still reports the nearest face, a lower bound that only grows with more iterations
+    double previous = 0.0;
+    for (std::size_t iterations = 1; iterations < 12; ++iterations) {
+        const auto early = epa(s1, s3, iterations);
+        assert(early.intersecting && early.depth >= previous - 1e-12 && early.depth <= overlap.depth + 1e-9);
+        previous = early.depth;
+    }
+
+    const Box<double> unit { Vec3(0.0), Mat3<double>::identity(), Vec3(1.0) };
+    const Capsule<double> capsule { Vec3(3.0, -1.0, 0.0), Vec3(3.0, 1.0, 0.0), 0.5 };
+    assert(close(gjk_distance(unit, capsule).distance, 1.5));
+
+    const Vec3<double> corners[] = {
+        Vec3(-1.0, -1.0, -1.0), Vec3(1.0, -1.0, -1.0), Vec3(-1.0, 1.0, -1.0), Vec3(1.0, 1.0, -1.0),
+        Vec3(-1.0, -1.0, 1.0), Vec3(1.0, -1.0, 1.0), Vec3(-1.0, 1.0, 1.0), Vec3(1.0, 1.0, 1.0),
+    };
+    const Hull<double> hull { corners };
+    assert(close(gjk_distance(hull, Sphere<double> { Vec3(0.0, 0.0, 4.0), 1.0 }).distance, 2.0));
+    assert(close(gjk_distance(hull, Sphere<double> { Vec3(3.0, 3.0, 3.0), 1.0 }).distance, std::sqrt(12.0) - 1.0));
+
+    // Box rotated 45 degrees about z, its edge reaches sqrt(2) along x
+    const double c = std::sqrt(0.5);
+    const Box<double> turned { Vec3(2.2, 0.0, 0.0), Mat3(Vec3(c, c, 0.0), Vec3(-c, c, 0.0), Vec3(0.0, 0.0, 1.0)), Vec3(1.0) };
+    const auto face = sat(unit, turned);
+    const auto deep = epa(unit, turned);
+    assert(face.intersecting && close(face.depth, 1.0 + std::sqrt(2.0) - 2.2) && face.normal.x > 0.999);
+    assert(deep.intersecting && std::abs(deep.depth - face.depth) < 1e-3);
+
+    // Axis-aligned pairs, box supports often land collinear or coplanar with the polytope
+    const Box<double> resting_a { Vec3(-0.34519042608145201, -0.35190144017430619, 0.10256523356201898), Mat3<double>::identity(),
+                                  Vec3(0.59587234763356689, 1.3200107700971524, 0.53325505685420538) };
+    const Box<double> resting_b { Vec3(0.17860274126338285, -0.5357650348277867, -0.72308094326718708), Mat3<double>::identity(),
+                                  Vec3(1.3752569745643719, 0.58266660319431707, 1.4070967509647276) };
+    assert(std::abs(epa(resting_a, resting_b).depth - sat(resting_a, resting_b).depth) < 1e-9);
+    std::mt19937 rng(32);
+    std::uniform_real_distribution<double> offset(-1.0, 1.0), extent(0.2, 1.5);
+    for (int i = 0; i < 3000; ++i) {
+        const Box<double> a { Vec3(offset(rng), offset(rng), offset(rng)), Mat3<double>::identity(), Vec3(extent(rng), extent(rng), extent(rng)) };
+        const Box<double> b { Vec3(offset(rng), offset(rng), offset(rng)), Mat3<double>::identity(), Vec3(extent(rng), extent(rng), extent(rng)) };
+        const auto expected = sat(a, b);
+        if (expected.intersecting && expected.depth > 1e-3) {
+            const auto found = epa(a, b);
+            assert(found.intersecting && found.converged && std::abs(found.depth - expected.depth) < 1e-6 && magnitude(found.normal - expected.normal) < 1e-6);
+        }
+    }
+
+    std::vector<Box<double>> left(100, unit), right;
+    for (int i = 0; i < 100; ++i) {
+        right.push_back(Box<double> { Vec3(0.03 * i, 0.0, 0.0), Mat3<double>::identity(), Vec3(0.5) });
+    }
+    std::vector<BoxContact<double>> contacts(100);
+    sat<double>(left, right, contacts);
+    std::vector<GjkResult<double>> distances(100);
+    gjk_distance(std::span<const Box<double>>(left), std::span<const Box<double>>(right), std::span(distances));
+    for (int i = 0; i < 100; ++i) {
+        assert(close(contacts[i].depth, 1.5 - 0.03 * i));
+        assert(contacts[i].intersecting == distances[i].intersecting || close(contacts[i].depth, 0.0));
+        assert(close(distances[i].distance, std::max(0.0, 0.03 * i - 1.5)));
+    }
+}
+
+void test_sampling()
+{
+    const auto known = Philox(0)(0);
+    assert(known[0] == 0x6627e8d5 && known[1] == 0xe169c58d && known[2] == 0xbc57ac4c && known[3] == 0x9b00dbd8);
+
+    const Philox rng(33);
+    const std::size_t n = 100000;
+    std::vector<Vec3<float>> sphere(n), tail(n / 2);
+    sample_sphere(rng, 0, VecView<float, 3>(std::span(sphere)));
+    sample_sphere(rng, n / 2, VecView<float, 3>(std::span(tail)));
+    for (std::size_t i = 0; i < n; ++i) {
+        assert(std::abs(dot(sphere[i], sphere[i]) - 1.0f) < 1e-4f);
+    }
+    assert(std::equal(tail.begin(), tail.end(), sphere.begin() + n / 2));
+    assert(!(rng.stream(1)(0) == rng(0)));
+
+    std::vector<double> x(n), y(n), z(n);
+    double cos_mean = 0.0, hemi_mean = 0.0, disk_r2 = 0.0;
+    sample_cosine_hemisphere(rng, 0, std::span(x), std::span(y), std::span(z));
+    for (std::size_t i = 0; i < n; ++i) {
+        assert(z[i] >= 0.0 && std::abs(x[i] * x[i] + y[i] * y[i] + z[i] * z[i] - 1.0) < 1e-9);
+        cos_mean += z[i] / n;
+    }
+    sample_hemisphere(rng, 0, std::span(x), std::span(y), std::span(z));
+    for (std::size_t i = 0; i < n; ++i) {
+        assert(z[i] >= 0.0);
+        hemi_mean += z[i] / n;
+    }
+    sample_disk(rng, 0, std::span(x), std::span(y));
+    for (std::size_t i = 0; i < n; ++i) {
+        assert(x[i] * x[i] + y[i] * y[i] <= 1.0);
+        disk_r2 += (x[i] * x[i] + y[i] * y[i]) / n;
+    }
+    assert(std::abs(cos_mean - 2.0 / 3.0) < 0.01 && std::abs(hemi_mean - 0.5) < 0.01 && std::abs(disk_r2 - 0.5) < 0.01);
+
+    std::vector<Vec3<double>> points(n);
+    sample_triangle(rng, 7, Vec3(0.0), Vec3(1.0, 0.0, 0.0), Vec3(0.0, 1.0, 0.0), VecView<double, 3>(std::span(points)));
+    double below = 0.0;
+    for (const auto &p : points) {
+        assert(p.x >= 0.0 && p.y >= 0.0 && p.x + p.y <= 1.0 + 1e-12 && p.z == 0.0);
+        below += (p.x + p.y < std::sqrt(0.5)) ? 1.0 / n : 0.0;
+    }
+    assert(std::abs(below - 0.5) < 0.01);
+}
+
+void test_dual()
+{
+    using D = Dual<double, 3>;
+    const Vec3<D> p(D::variable(1.0, 0), D::variable(2.0, 1), D::variable(2.0, 2));
+    const Vec3<double> c(1.0, 0.0, -1.0);
+
+    const D len = magnitude(p);
+    assert(std::abs(len.value - 3.0) < 1e-12);
+    for (std::size_t i = 0; i < 3; ++i) {
+        const double expected = i == 0 ? 1.0 / 3.0 : 2.0 / 3.0;
+        assert(std::abs(len.tangent[i] - expected) < 1e-12);
+    }
+
+    const D d = dot(p, Vec3<D>(D(c.x), D(c.y), D(c.z)));
+    assert(d.value == -1.0 && d.tangent[0] == 1.0 && d.tangent[1] == 0.0 && d.tangent[2] == -1.0);
+
+    const Vec3<D> n = cross(p, Vec3<D>(D(0.0), D(0.0), D(1.0)));
+    assert(n.x.value == 2.0 && n.x.tangent[1] == 1.0 && n.y.tangent[0] == -1.0);
+
+    const Dual<float, 2> x = Dual<float, 2>::variable(0.5f, 0), y = Dual<float, 2>::variable(2.0f, 1);
+    const auto f = sin(x) * exp(y) / (1.0f + x * y) - atan2(y, x);
+    const float h = 1e-3f;
+    const auto g = [](float a, float b) { return std::sin(a) * std::exp(b) / (1.0f + a * b) - std::atan2(b, a); };
+    assert(std::abs(f.value - g(0.5f, 2.0f)) < 1e-5f);
+    assert(std::abs(f.tangent[0] - (g(0.5f + h, 2.0f) - g(0.5f - h, 2.0f)) / (2 * h)) < 1e-2f);
+    assert(std::abs(f.tangent[1] - (g(0.5f, 2.0f + h) - g(0.5f, 2.0f - h)) / (2 * h)) < 1e-2f);
+    assert(x < y && D(2.0) == D::variable(2.0, 1));
+}
+
+void test_cached_mat()
+{
+    std::mt19937 rng(35);
+    std::uniform_real_distribution<double> dist(-2.0, 2.0);
+    const auto random_mat = [&] {
+        Mat4<double> m;
+        for (auto &c : m.cols) {
+            c = Vec4(dist(rng), dist(rng), dist(rng), dist(rng));
+        }
+        return m;
+    };
+    const auto near = [](const Mat4<double> &a, const Mat4<double> &b) {
+        for (std::size_t r = 0; r < 4; ++r) {
+            for (std::size_t c = 0; c < 4; ++c) {
+                if (std::abs(a(r, c) - b(r, c)) > 1e-9) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    };
+
+    Mat4<double> diag(2.0);
+    diag(3, 3) = 1.0;
+    assert(diag.determinant() == 8.0);
+
+    CachedMat4<double> cached(random_mat());
+    assert(cached.dirty());
+    const Mat4<double> inv = cached.inverse();
+    assert(!cached.dirty());
+    assert(near(cached.matrix() * inv, Mat4<double>::identity()));
+    assert(cached.normal_matrix() == inv.transpose());
+    assert(std::abs(cached.determinant() * inv.determinant() - 1.0) < 1e-9);
+
+    const auto version = cached.version();
+    cached.set(0, 3, 5.0);
+    assert(cached.dirty() && cached.version() != version);
+    assert(near(cached.matrix() * cached.inverse(), Mat4<double>::identity()));
+    cached.modify([](Mat4<double> &m) { m = m * Mat4<double>(2.0); });
+    assert(near(cached.inverse() * cached.matrix(), Mat4<double>::identity()));
+
+    std::vector<CachedMat4<double>> batch;
+    for (std::size_t i = 0; i < 5000; ++i) {
+        batch.emplace_back(random_mat());
+    }
+    refresh(std::span<const CachedMat4<double>>(batch));
+    batch[7] = Mat4<double>(3.0);
+    for (std::size_t i = 0; i < batch.size(); ++i) {
+        assert(batch[i].dirty() == (i == 7));
+    }
+    refresh(std::span<const CachedMat4<double>>(batch));
+    assert(!batch[7].dirty() && batch[7].determinant() == 81.0);
+    assert(near(batch[4999].matrix() * batch[4999].inverse(), Mat4<double>::identity()));
+}
+
+void test_mesh()
+{
+    // Octahedron, every vertex normal points along its vertex
+    const std::vector<Vec3<double>> octa = {
+            Vec3(1.0, 0.0, 0.0), Vec3(-1.0, 0.0, 0.0), Vec3(0.0, 1.0, 0.0),
+            Vec3(0.0, -1.0, 0.0), Vec3(0.0, 0.0, 1.0), Vec3(0.0, 0.0, -1.0),
+    };
+    const std::vector<uint32_t> octa_tris = {
+            0, 2, 4, 2, 1, 4, 1, 3, 4, 3, 0, 4,
+            2, 0, 5, 1, 2, 5, 3, 1, 5, 0, 3, 5,
+    };
+    std::vector<Vec3<double>> normals(6), faces(8);
+    vertex_normals<double>(octa, octa_tris, normals);
+    face_normals<double>(octa, octa_tris, faces);
+    for (std::size_t v = 0; v < 6; ++v) {
+        assert(magnitude(normals[v] - octa[v]) < 1e-12);
+    }
+    for (const auto &f : faces) {
+        assert(std::abs(std::abs(f.x) - 1 / std::sqrt(3.0)) < 1e-12 && f.z * f.x * f.y != 0);
+    }
+    assert(faces[0].x > 0 && faces[0].y > 0 && faces[0].z > 0);
+    assert(std::abs(surface_area<double>(octa, octa_tris) - 4 * std::sqrt(3.0)) < 1e-12);
+
+    // Flat n x n grid with uv = xy, tangents follow +x
+    const std::size_t n = 300;
+    std::vector<Vec3<float>> grid;
+    std::vector<Vec2<float>> uvs;
+    std::vector<uint32_t> tris;
+    for (std::size_t j = 0; j <= n; ++j) {
+        for (std::size_t i = 0; i <= n; ++i) {
+            grid.emplace_back(float(i), float(j), 0.0f);
+            uvs.emplace_back(float(i) / n, float(j) / n);
+        }
+    }
+    for (std::size_t j = 0; j < n; ++j) {
+        for (std::size_t i = 0; i < n; ++i) {
+            const auto v = static_cast<uint32_t>(j * (n + 1) + i);
+            const auto up = static_cast<uint32_t>(v + n + 1);
+            tris.insert(tris.end(), { v, v + 1, up + 1, v, up + 1, up });
+        }
+    }
+    std::vector<Vec3<float>> grid_normals(grid.size());
+    std::vector<Vec4<float>> grid_tangents(grid.size());
+    std::vector<float> areas(tris.size() / 3);
+    vertex_normals<float>(grid, tris, grid_normals);
+    tangents<float>(grid, uvs, grid_normals, tris, grid_tangents);
+    face_areas<float>(grid, tris, areas);
+    for (std::size_t v = 0; v < grid.size(); ++v) {
+        assert(magnitude(grid_normals[v] - Vec3(0.0f, 0.0f, 1.0f)) < 1e-6f);
+        assert(std::abs(grid_tangents[v].x - 1.0f) < 1e-5f && grid_tangents[v].w == 1.0f);
+    }
+    assert(std::all_of(areas.begin(), areas.end(), [](float a) { return std::abs(a - 0.5f) < 1e-6f; }));
+
+    // Mirrored uvs flip the handedness
+    for (auto &uv : uvs) {
+        uv.x = -uv.x;
+    }
+    tangents<float>(grid, uvs, grid_normals, tris, grid_tangents);
+    assert(grid_tangents[0].x < -0.99f && grid_tangents[0].w == -1.0f);
+
+    // Shuffled random soup against a serial accumulation
+    std::mt19937 rng(36);
+    std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+    std::uniform_int_distribution<uint32_t> pick(0, 999);
+    std::vector<Vec3<float>> soup(1000);
+    for (auto &p : soup) {
+        p = Vec3(dist(rng), dist(rng), dist(rng));
+    }
+    std::vector<uint32_t> soup_tris(3 * 50000);
+    for (auto &i : soup_tris) {
+        i = pick(rng);
+    }
+    std::vector<Vec3<float>> soup_normals(soup.size()), expected(soup.size(), Vec3(0.0f));
+    vertex_normals<float>(soup, soup_tris, soup_normals);
+    for (std::size_t t = 0; t < soup_tris.size() / 3; ++t) {
+        const Vec3<float> &p0 = soup[soup_tris[3 * t]];
+        const Vec3<float> c = cross(soup[soup_tris[3 * t + 1]] - p0, soup[soup_tris[3 * t + 2]] - p0);
+        for (std::size_t k = 0; k < 3; ++k) {
+            expected[soup_tris[3 * t + k]] += c;
+        }
+    }
+    for (std::size_t v = 0; v < soup.size(); ++v) {
+        assert(magnitude(soup_normals[v] - expected[v] / Vec3(magnitude(expected[v]))) < 1e-4f);
+    }
+
+    const auto box = bounds<float>(grid);
+    assert(box.lo == Vec3(0.0f, 0.0f, 0.0f) && box.hi == Vec3(float(n), float(n), 0.0f));
+}